@@ -0,0 +1,559 @@
+/*
+ASSIGNMENT 10 (parallel variant):
+Merge sort and quicksort forked onto a work-stealing thread pool.
+Every worker owns a deque of tasks. It pushes and pops its own forks at the tail; a worker
+that runs dry, or is waiting for a task somebody took, steals the oldest (largest) task from
+the head of another deque. Ranges below SEQUENTIAL_CUTOFF are sorted sequentially, and merge
+sort also splits every large merge at co-ranked points so the top-level merges run in parallel.
+
+Build: gcc -O3 -pthread parallel_sort.c -o parallel_sort
+Usage: ./parallel_sort [number of elements] [maximum threads]
+*/
+
+#include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
+#include<stdint.h>
+#include<stdatomic.h>
+#include<pthread.h>
+#include<sched.h>
+#include<time.h>
+#include<unistd.h>
+
+/* Ranges this short are not split into tasks any more */
+#ifndef SEQUENTIAL_CUTOFF
+#define SEQUENTIAL_CUTOFF (1 << 14)
+#endif
+#define INSERTION_CUTOFF 16
+#define NINTHER_THRESHOLD 128
+/* Failed steal rounds before an idle worker starts sleeping between attempts */
+#define SPIN_ROUNDS 64
+/* Timed runs per sort and thread count after one untimed warm-up; the fastest one is reported */
+#define TIMED_RUNS 5
+
+struct Task{
+    void (*run)(struct Task* task);
+    atomic_int done;
+};
+
+struct Deque{
+    pthread_mutex_t lock;
+    struct Task** items;
+    long head;
+    long tail;
+    long capacity;
+};
+
+struct Pool{
+    int threads;
+    int started;
+    struct Deque* deques;
+    pthread_t* tids;
+    atomic_int stop;
+};
+
+struct Pool pool;
+_Thread_local int workerId = 0;
+_Thread_local unsigned rngState = 1;
+
+/* Pushes at the tail of the calling worker's deque; returns 0 if the deque cannot grow */
+int pushTask(struct Task* task){
+    struct Deque* d = &pool.deques[workerId];
+    pthread_mutex_lock(&d->lock);
+    if (d->tail == d->capacity){
+        if (d->head > 0){
+            memmove(d->items, d->items + d->head, (d->tail - d->head) * sizeof(struct Task*));
+            d->tail -= d->head;
+            d->head = 0;
+        } else {
+            long capacity = d->capacity ? 2 * d->capacity : 64;
+            struct Task** items = realloc(d->items, capacity * sizeof(struct Task*));
+            if (items == NULL){
+                pthread_mutex_unlock(&d->lock);
+                return 0;
+            }
+            d->items = items;
+            d->capacity = capacity;
+        }
+    }
+    d->items[d->tail++] = task;
+    pthread_mutex_unlock(&d->lock);
+    return 1;
+}
+
+/* Takes task back off the owner's tail if nobody has stolen it yet */
+int popTask(struct Task* task){
+    struct Deque* d = &pool.deques[workerId];
+    int found = 0;
+    pthread_mutex_lock(&d->lock);
+    if (d->tail > d->head && d->items[d->tail - 1] == task){
+        d->tail--;
+        if (d->tail == d->head) d->head = d->tail = 0;
+        found = 1;
+    }
+    pthread_mutex_unlock(&d->lock);
+    return found;
+}
+
+struct Task* stealTask(int victim){
+    struct Deque* d = &pool.deques[victim];
+    struct Task* task = NULL;
+    pthread_mutex_lock(&d->lock);
+    if (d->tail > d->head){
+        task = d->items[d->head++];
+        if (d->tail == d->head) d->head = d->tail = 0;
+    }
+    pthread_mutex_unlock(&d->lock);
+    return task;
+}
+
+/* Tries every other worker once, starting at a random one */
+struct Task* findWork(){
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    int start = rngState % pool.threads;
+    for (int i = 0; i < pool.threads; i++){
+        int victim = (start + i) % pool.threads;
+        if (victim == workerId) continue;
+        struct Task* task = stealTask(victim);
+        if (task != NULL) return task;
+    }
+    return NULL;
+}
+
+void runTask(struct Task* task){
+    task->run(task);
+    atomic_store_explicit(&task->done, 1, memory_order_release);
+}
+
+void backoff(int* idle){
+    if (++*idle < SPIN_ROUNDS){
+        sched_yield();
+    } else {
+        struct timespec pause = {0, 50000};
+        nanosleep(&pause, NULL);
+    }
+}
+
+/* Makes task available to thieves; runs it at once if it cannot be queued */
+void spawn(struct Task* task, void (*run)(struct Task*)){
+    task->run = run;
+    atomic_store_explicit(&task->done, 0, memory_order_relaxed);
+    if (!pushTask(task)) runTask(task);
+}
+
+/* Joins a spawned task: runs it here if it was not stolen, otherwise steals other work until it is done */
+void waitFor(struct Task* task){
+    if (popTask(task)){
+        runTask(task);
+        return;
+    }
+    int idle = 0;
+    while (!atomic_load_explicit(&task->done, memory_order_acquire)){
+        struct Task* other = findWork();
+        if (other != NULL){
+            runTask(other);
+            idle = 0;
+        } else {
+            backoff(&idle);
+        }
+    }
+}
+
+void* workerLoop(void* arg){
+    workerId = (int)(intptr_t)arg;
+    rngState = 2654435761u * (workerId + 1);
+    int idle = 0;
+    while (!atomic_load_explicit(&pool.stop, memory_order_acquire)){
+        struct Task* task = findWork();
+        if (task != NULL){
+            runTask(task);
+            idle = 0;
+        } else {
+            backoff(&idle);
+        }
+    }
+    return NULL;
+}
+
+/* The calling thread becomes worker 0; threads - 1 more workers are started */
+int poolStart(int threads){
+    pool.threads = threads;
+    pool.started = 0;
+    atomic_store(&pool.stop, 0);
+    pool.deques = calloc(threads, sizeof(struct Deque));
+    pool.tids = malloc(threads * sizeof(pthread_t));
+    if (pool.deques == NULL || pool.tids == NULL){
+        free(pool.deques);
+        free(pool.tids);
+        return 0;
+    }
+    for (int i = 0; i < threads; i++){
+        pthread_mutex_init(&pool.deques[i].lock, NULL);
+    }
+    workerId = 0;
+    for (int i = 1; i < threads; i++){
+        if (pthread_create(&pool.tids[i], NULL, workerLoop, (void*)(intptr_t)i) != 0){
+            printf("Could only start %d of %d threads\n", i, threads);
+            break;
+        }
+        pool.started = i;
+    }
+    return 1;
+}
+
+void poolStop(){
+    atomic_store(&pool.stop, 1);
+    for (int i = 1; i <= pool.started; i++){
+        pthread_join(pool.tids[i], NULL);
+    }
+    for (int i = 0; i < pool.threads; i++){
+        pthread_mutex_destroy(&pool.deques[i].lock);
+        free(pool.deques[i].items);
+    }
+    free(pool.deques);
+    free(pool.tids);
+}
+
+void insertionSort(int arr[], long n){
+    for (long i = 1; i < n; i++){
+        int key = arr[i];
+        long j = i - 1;
+        while (j >= 0 && arr[j] > key){
+            arr[j + 1] = arr[j];
+            j--;
+        }
+        arr[j + 1] = key;
+    }
+}
+
+/* Stable merge of a[0..na) and b[0..nb) into out; runs already in order are copied across */
+void mergeRuns(const int* a, long na, const int* b, long nb, int* out){
+    if (na == 0 || nb == 0 || a[na - 1] <= b[0]){
+        memcpy(out, a, na * sizeof(int));
+        memcpy(out + na, b, nb * sizeof(int));
+        return;
+    }
+    long i = 0, j = 0, k = 0;
+    while (i < na && j < nb){
+        if (a[i] <= b[j]) out[k++] = a[i++];
+        else out[k++] = b[j++];
+    }
+    while (i < na) out[k++] = a[i++];
+    while (j < nb) out[k++] = b[j++];
+}
+
+/* Sorts src into dst; both start out holding the same elements and swap roles at every level */
+void mergeSortInto(int src[], int dst[], long n){
+    if (n <= INSERTION_CUTOFF){
+        insertionSort(dst, n);
+        return;
+    }
+    long mid = n / 2;
+    mergeSortInto(dst, src, mid);
+    mergeSortInto(dst + mid, src + mid, n - mid);
+    mergeRuns(src, mid, src + mid, n - mid, dst);
+}
+
+/*
+Co-rank: the number of elements a contributes to the first k elements of the stable merge of a and b.
+It is the smallest i with b[k-i-1] < a[i], found by binary search, so a[0..i) and b[0..k-i) merge
+into out[0..k) and the rest into out[k..) independently.
+*/
+long coRank(long k, const int* a, long na, const int* b, long nb){
+    long lo = k > nb ? k - nb : 0;
+    long hi = k < na ? k : na;
+    while (lo < hi){
+        long i = lo + (hi - lo) / 2;
+        long j = k - i;
+        if (j == 0 || b[j - 1] < a[i]) hi = i;
+        else lo = i + 1;
+    }
+    return lo;
+}
+
+struct MergeTask{
+    struct Task task;
+    const int* a;
+    long na;
+    const int* b;
+    long nb;
+    int* out;
+};
+
+void parallelMerge(const int* a, long na, const int* b, long nb, int* out);
+
+void runMergeTask(struct Task* task){
+    struct MergeTask* m = (struct MergeTask*)task;
+    parallelMerge(m->a, m->na, m->b, m->nb, m->out);
+}
+
+/* Splits the output in half at co-ranked points and merges the halves as two tasks */
+void parallelMerge(const int* a, long na, const int* b, long nb, int* out){
+    if (na + nb <= SEQUENTIAL_CUTOFF){
+        mergeRuns(a, na, b, nb, out);
+        return;
+    }
+    long k = (na + nb) / 2;
+    long i = coRank(k, a, na, b, nb);
+    struct MergeTask first = {.a = a, .na = i, .b = b, .nb = k - i, .out = out};
+    spawn(&first.task, runMergeTask);
+    parallelMerge(a + i, na - i, b + k - i, nb - (k - i), out + k);
+    waitFor(&first.task);
+}
+
+struct SortTask{
+    struct Task task;
+    int* arr;
+    int* scratch;
+    long n;
+    int flag;
+};
+
+void parallelMergeSortTo(int arr[], int scratch[], long n, int intoScratch);
+
+void runMergeSortTask(struct Task* task){
+    struct SortTask* s = (struct SortTask*)task;
+    parallelMergeSortTo(s->arr, s->scratch, s->n, s->flag);
+}
+
+/* Sorts the n elements of arr, leaving the result in scratch when intoScratch is set and in arr otherwise */
+void parallelMergeSortTo(int arr[], int scratch[], long n, int intoScratch){
+    if (n <= SEQUENTIAL_CUTOFF){
+        memcpy(scratch, arr, n * sizeof(int));
+        if (intoScratch) mergeSortInto(arr, scratch, n);
+        else mergeSortInto(scratch, arr, n);
+        return;
+    }
+    long mid = n / 2;
+    struct SortTask left = {.arr = arr, .scratch = scratch, .n = mid, .flag = !intoScratch};
+    spawn(&left.task, runMergeSortTask);
+    parallelMergeSortTo(arr + mid, scratch + mid, n - mid, !intoScratch);
+    waitFor(&left.task);
+
+    int* src = intoScratch ? arr : scratch;
+    int* dst = intoScratch ? scratch : arr;
+    parallelMerge(src, mid, src + mid, n - mid, dst);
+}
+
+void parallelMergeSort(int arr[], long n){
+    int* scratch = malloc((n > 0 ? n : 1) * sizeof(int));
+    if (scratch == NULL){
+        printf("Memory allocation failed!\n");
+        return;
+    }
+    parallelMergeSortTo(arr, scratch, n, 0);
+    free(scratch);
+}
+
+void swap(int arr[], long a, long b){
+    int temp = arr[a];
+    arr[a] = arr[b];
+    arr[b] = temp;
+}
+
+long medianOfThree(int arr[], long a, long b, long c){
+    if (arr[a] < arr[b]){
+        if (arr[b] < arr[c]) return b;
+        return arr[a] < arr[c] ? c : a;
+    }
+    if (arr[a] < arr[c]) return a;
+    return arr[b] < arr[c] ? c : b;
+}
+
+long choosePivot(int arr[], long n){
+    long mid = n / 2;
+    if (n < NINTHER_THRESHOLD) return medianOfThree(arr, 0, mid, n - 1);
+    long step = n / 8;
+    return medianOfThree(arr, medianOfThree(arr, 0, step, 2 * step),
+                              medianOfThree(arr, mid - step, mid, mid + step),
+                              medianOfThree(arr, n - 1 - 2 * step, n - 1 - step, n - 1));
+}
+
+/* Three-way partition: arr[0..*lt) < pivot, arr[*lt..*gt] == pivot, arr(*gt..n) > pivot */
+void partition(int arr[], long n, long* lt, long* gt){
+    swap(arr, 0, choosePivot(arr, n));
+    int pivot = arr[0];
+    long l = 0, i = 1, g = n - 1;
+    while (i <= g){
+        if (arr[i] < pivot) swap(arr, l++, i++);
+        else if (arr[i] > pivot) swap(arr, i, g--);
+        else i++;
+    }
+    *lt = l;
+    *gt = g;
+}
+
+void siftDown(int arr[], long root, long size){
+    int value = arr[root];
+    while (2 * root + 1 < size){
+        long child = 2 * root + 1;
+        if (child + 1 < size && arr[child + 1] > arr[child]) child++;
+        if (arr[child] <= value) break;
+        arr[root] = arr[child];
+        root = child;
+    }
+    arr[root] = value;
+}
+
+void heapSort(int arr[], long n){
+    for (long root = n / 2 - 1; root >= 0; root--) siftDown(arr, root, n);
+    for (long end = n - 1; end > 0; end--){
+        swap(arr, 0, end);
+        siftDown(arr, 0, end);
+    }
+}
+
+/* Sequential introsort: smaller side recursed, larger side looped, heapsort past depthLimit */
+void introSort(int arr[], long n, int depthLimit){
+    while (n > INSERTION_CUTOFF){
+        if (depthLimit-- == 0){
+            heapSort(arr, n);
+            return;
+        }
+        long lt, gt;
+        partition(arr, n, &lt, &gt);
+        if (lt < n - 1 - gt){
+            introSort(arr, lt, depthLimit);
+            arr += gt + 1;
+            n -= gt + 1;
+        } else {
+            introSort(arr + gt + 1, n - 1 - gt, depthLimit);
+            n = lt;
+        }
+    }
+    insertionSort(arr, n);
+}
+
+struct QuickTask{
+    struct Task task;
+    int* arr;
+    long n;
+    int depthLimit;
+};
+
+void parallelQuickSortRange(int arr[], long n, int depthLimit);
+
+void runQuickTask(struct Task* task){
+    struct QuickTask* q = (struct QuickTask*)task;
+    parallelQuickSortRange(q->arr, q->n, q->depthLimit);
+}
+
+/* Partitions sequentially, then sorts the two sides as a spawned task and inline */
+void parallelQuickSortRange(int arr[], long n, int depthLimit){
+    if (n <= SEQUENTIAL_CUTOFF){
+        introSort(arr, n, depthLimit);
+        return;
+    }
+    if (depthLimit == 0){
+        heapSort(arr, n);
+        return;
+    }
+    long lt, gt;
+    partition(arr, n, &lt, &gt);
+    struct QuickTask left = {.arr = arr, .n = lt, .depthLimit = depthLimit - 1};
+    spawn(&left.task, runQuickTask);
+    parallelQuickSortRange(arr + gt + 1, n - 1 - gt, depthLimit - 1);
+    waitFor(&left.task);
+}
+
+void parallelQuickSort(int arr[], long n){
+    int depthLimit = 0;
+    for (long m = n; m > 1; m >>= 1) depthLimit += 2;
+    parallelQuickSortRange(arr, n, depthLimit);
+}
+
+double seconds(){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Sorted, and the same multiset as the input as far as an order-independent checksum can tell */
+int verify(int arr[], long n, unsigned long long checksum){
+    unsigned long long sum = 0;
+    for (long i = 0; i < n; i++){
+        if (i > 0 && arr[i - 1] > arr[i]) return 0;
+        sum += (unsigned long long)arr[i] * 0x9E3779B97F4A7C15ull ^ (unsigned)arr[i];
+    }
+    return sum == checksum;
+}
+
+/* Best time of TIMED_RUNS sorts of a fresh copy of orig, after a warm-up run that faults in the
+   pages and wakes the workers; -1 if any run sorts wrongly */
+double bestTime(void (*sort)(int[], long), int arr[], const int orig[], long n, unsigned long long checksum){
+    double best = 0;
+    for (int run = 0; run <= TIMED_RUNS; run++){
+        memcpy(arr, orig, n * sizeof(int));
+        double start = seconds();
+        sort(arr, n);
+        double elapsed = seconds() - start;
+        if (!verify(arr, n, checksum)) return -1;
+        if (run > 0 && (run == 1 || elapsed < best)) best = elapsed;
+    }
+    return best;
+}
+
+int main(int argc, char* argv[]){
+    long n = argc > 1 ? atol(argv[1]) : 10000000;
+    int maxThreads = argc > 2 ? atoi(argv[2]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (n <= 0 || maxThreads <= 0){
+        printf("Usage: %s [number of elements] [maximum threads]\n", argv[0]);
+        return 1;
+    }
+
+    int* orig = malloc(n * sizeof(int));
+    int* arr = malloc(n * sizeof(int));
+    if (orig == NULL || arr == NULL){
+        printf("Memory allocation failed!\n");
+        free(orig);
+        free(arr);
+        return 1;
+    }
+
+    unsigned long long state = 88172645463325252ull, checksum = 0;
+    for (long i = 0; i < n; i++){
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        orig[i] = (int)(state >> 32);
+        checksum += (unsigned long long)orig[i] * 0x9E3779B97F4A7C15ull ^ (unsigned)orig[i];
+    }
+
+    printf("Sorting %ld random ints, sequential cutoff %d, best of %d runs\n\n", n, SEQUENTIAL_CUTOFF, TIMED_RUNS);
+    if (n <= SEQUENTIAL_CUTOFF && maxThreads > 1){
+        /* Both sorts finish without forking a task, so extra threads could only add noise */
+        printf("%ld elements do not exceed the sequential cutoff; timing 1 thread only\n\n", n);
+        maxThreads = 1;
+    }
+    printf("%-8s %14s %8s %14s %8s\n", "Threads", "Merge sort (s)", "Speedup", "Quicksort (s)", "Speedup");
+
+    double mergeBase = 0, quickBase = 0;
+    for (int threads = 1; ; threads = threads * 2 < maxThreads ? threads * 2 : maxThreads){
+        if (!poolStart(threads)){
+            printf("Memory allocation failed!\n");
+            break;
+        }
+
+        double mergeTime = bestTime(parallelMergeSort, arr, orig, n, checksum);
+        double quickTime = mergeTime >= 0 ? bestTime(parallelQuickSort, arr, orig, n, checksum) : -1;
+
+        poolStop();
+        if (mergeTime < 0 || quickTime < 0){
+            printf("Sort result is wrong with %d threads!\n", threads);
+            break;
+        }
+        if (threads == 1){
+            mergeBase = mergeTime;
+            quickBase = quickTime;
+        }
+        printf("%-8d %14.3f %7.2fx %14.3f %7.2fx\n", threads, mergeTime, mergeBase / mergeTime,
+               quickTime, quickBase / quickTime);
+        if (threads == maxThreads) break;
+    }
+
+    free(orig);
+    free(arr);
+    return 0;
+}
@@ -5,8 +5,53 @@ Show the number of comparison required for a given input.
 */
 
 #include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
 
-int compCount = 0;
+/* Operation counters for teaching builds; compile with -DSORT_STATS=0 to remove them from the sorts */
+#ifndef SORT_STATS
+#define SORT_STATS 1
+#endif
+
+struct SortStats{
+    long long comparisons;
+    long long swaps;
+    long long shifts;
+    long long bytesMoved;
+    int depth;
+    int maxDepth;
+};
+
+#if SORT_STATS
+struct SortStats stats;
+#define STAT_COMPARE() (stats.comparisons++)
+#define STAT_SWAP() (stats.swaps++, stats.bytesMoved += 2 * sizeof(int))
+#define STAT_SHIFT() (stats.shifts++, stats.bytesMoved += sizeof(int))
+#define STAT_MOVE(count) (stats.bytesMoved += (long long)(count) * sizeof(int))
+#define STAT_ENTER() ((void)(++stats.depth > stats.maxDepth && (stats.maxDepth = stats.depth)))
+#define STAT_LEAVE() (stats.depth--)
+#else
+#define STAT_COMPARE() ((void)0)
+#define STAT_SWAP() ((void)0)
+#define STAT_SHIFT() ((void)0)
+#define STAT_MOVE(count) ((void)0)
+#define STAT_ENTER() ((void)0)
+#define STAT_LEAVE() ((void)0)
+#endif
+
+void resetStats(){
+#if SORT_STATS
+    stats = (struct SortStats){0};
+#endif
+}
+
+void printStats(){
+#if SORT_STATS
+    printf("Comparisons: %lld\n", stats.comparisons);
+    printf("Swaps: %lld, Shifts: %lld, Bytes moved: %lld, Max recursion depth: %d\n",
+           stats.swaps, stats.shifts, stats.bytesMoved, stats.maxDepth);
+#endif
+}
 
 void printArray(int arr[], int n){
     for (int i = 0; i < n; i++) printf("%d ", arr[i]);
@@ -17,103 +62,282 @@ void copyArray(int src[], int dest[], int n){
     for (int i = 0; i < n; i++) dest[i] = src[i];
 }
 
-int partition(int arr[], int low, int high){
-    int pivot = arr[high];
-    int i = low - 1;
-    for (int j = low; j < high; j++){
-        compCount++;
-        if (arr[j] < pivot){
-            i++;
-            int temp = arr[i];
-            arr[i] = arr[j];
-            arr[j] = temp;
+/* Ranges this short are finished by insertion sort. Teaching builds default to 1 so the counters
+   show quicksort and merge sort themselves on classroom-sized inputs; override with -DINSERTION_CUTOFF=n */
+#ifndef INSERTION_CUTOFF
+#if SORT_STATS
+#define INSERTION_CUTOFF 1
+#else
+#define INSERTION_CUTOFF 16
+#endif
+#endif
+#if INSERTION_CUTOFF < 1
+#error "INSERTION_CUTOFF must be at least 1"
+#endif
+/* Ranges this long take the ninther (median of three medians) as pivot */
+#define NINTHER_THRESHOLD 128
+
+void swap(int arr[], int a, int b){
+    int temp = arr[a];
+    arr[a] = arr[b];
+    arr[b] = temp;
+    STAT_SWAP();
+}
+
+void insertionSortRange(int arr[], int low, int high){
+    for (int i = low + 1; i <= high; i++){
+        int key = arr[i];
+        int j = i - 1;
+        while (j >= low){
+            STAT_COMPARE();
+            if (arr[j] > key){
+                arr[j + 1] = arr[j];
+                j--;
+                STAT_SHIFT();
+            } else break;
         }
+        arr[j + 1] = key;
+        STAT_MOVE(1);
     }
-    int temp = arr[i + 1];
-    arr[i + 1] = arr[high];
-    arr[high] = temp;
-    return i + 1;
 }
 
-void quickSort(int arr[], int low, int high){
-    if (low < high){
-        int pi = partition(arr, low, high);
-        quickSort(arr, low, pi - 1);
-        quickSort(arr, pi + 1, high);
+int medianOfThree(int arr[], int a, int b, int c){
+    STAT_COMPARE();
+    if (arr[a] < arr[b]){
+        STAT_COMPARE();
+        if (arr[b] < arr[c]) return b;
+        STAT_COMPARE();
+        return arr[a] < arr[c] ? c : a;
     }
+    STAT_COMPARE();
+    if (arr[a] < arr[c]) return a;
+    STAT_COMPARE();
+    return arr[b] < arr[c] ? c : b;
 }
 
-void merge(int arr[], int left, int mid, int right){
-    int n1 = mid - left + 1;
-    int n2 = right - mid;
-    int L[n1], R[n2];
-    
-    for (int i = 0; i < n1; i++) L[i] = arr[left + i];
-    for (int j = 0; j < n2; j++) R[j] = arr[mid + 1 + j];
-    
-    int i = 0, j = 0, k = left;
-    while (i < n1 && j < n2){
-        compCount++;
-        if (L[i] <= R[j]){
-            arr[k] = L[i];
-            i++;
+int choosePivot(int arr[], int low, int high){
+    int mid = low + (high - low) / 2;
+    if (high - low + 1 < NINTHER_THRESHOLD) return medianOfThree(arr, low, mid, high);
+    int step = (high - low + 1) / 8;
+    return medianOfThree(arr, medianOfThree(arr, low, low + step, low + 2 * step),
+                              medianOfThree(arr, mid - step, mid, mid + step),
+                              medianOfThree(arr, high - 2 * step, high - step, high));
+}
+
+/* Three-way (Dutch national flag) partition: afterwards arr[low..*lt-1] < pivot,
+   arr[*lt..*gt] == pivot and arr[*gt+1..high] > pivot, so runs of duplicates are done in one pass */
+void partition(int arr[], int low, int high, int* lt, int* gt){
+    swap(arr, low, choosePivot(arr, low, high));
+    int pivot = arr[low];
+    int l = low, i = low + 1, g = high;
+    while (i <= g){
+        STAT_COMPARE();
+        if (arr[i] < pivot){
+            swap(arr, l++, i++);
+            continue;
+        }
+        STAT_COMPARE();
+        if (arr[i] > pivot) swap(arr, i, g--);
+        else i++;
+    }
+    *lt = l;
+    *gt = g;
+}
+
+void siftDown(int arr[], int low, int root, int size){
+    int value = arr[low + root];
+    while (2 * root + 1 < size){
+        int child = 2 * root + 1;
+        if (child + 1 < size){
+            STAT_COMPARE();
+            if (arr[low + child + 1] > arr[low + child]) child++;
+        }
+        STAT_COMPARE();
+        if (arr[low + child] <= value) break;
+        arr[low + root] = arr[low + child];
+        STAT_SHIFT();
+        root = child;
+    }
+    arr[low + root] = value;
+    STAT_MOVE(1);
+}
+
+void heapSortRange(int arr[], int low, int high){
+    int size = high - low + 1;
+    for (int root = size / 2 - 1; root >= 0; root--) siftDown(arr, low, root, size);
+    for (int end = size - 1; end > 0; end--){
+        swap(arr, low, low + end);
+        siftDown(arr, low, 0, end);
+    }
+}
+
+/* Quicksort that recurses only into the smaller side (stack depth <= log2 n)
+   and hands the range to heapsort once depthLimit partitions have not finished it */
+void introSort(int arr[], int low, int high, int depthLimit){
+    STAT_ENTER();
+    while (high - low + 1 > INSERTION_CUTOFF){
+        if (depthLimit-- == 0){
+            heapSortRange(arr, low, high);
+            STAT_LEAVE();
+            return;
+        }
+        int lt, gt;
+        partition(arr, low, high, &lt, &gt);
+        if (lt - low < high - gt){
+            introSort(arr, low, lt - 1, depthLimit);
+            low = gt + 1;
         } else {
-            arr[k] = R[j];
-            j++;
+            introSort(arr, gt + 1, high, depthLimit);
+            high = lt - 1;
         }
-        k++;
     }
-    
-    while (i < n1){
-        arr[k] = L[i];
-        i++; k++;
+    insertionSortRange(arr, low, high);
+    STAT_LEAVE();
+}
+
+void quickSort(int arr[], int low, int high){
+    int depthLimit = 0;
+    for (int n = high - low + 1; n > 1; n >>= 1) depthLimit += 2;
+    introSort(arr, low, high, depthLimit);
+}
+
+/* Merges the sorted runs src[left..mid] and src[mid+1..right] into dst[left..right];
+   when the runs are already in order they are copied across without comparing elements */
+void merge(int src[], int dst[], int left, int mid, int right){
+    STAT_MOVE(right - left + 1);
+    STAT_COMPARE();
+    if (src[mid] <= src[mid + 1]){
+        memcpy(dst + left, src + left, (size_t)(right - left + 1) * sizeof(int));
+        return;
     }
-    
-    while (j < n2){
-        arr[k] = R[j];
-        j++; k++;
+
+    int i = left, j = mid + 1, k = left;
+    while (i <= mid && j <= right){
+        STAT_COMPARE();
+        if (src[i] <= src[j]) dst[k++] = src[i++];
+        else dst[k++] = src[j++];
     }
+    while (i <= mid) dst[k++] = src[i++];
+    while (j <= right) dst[k++] = src[j++];
 }
 
-void mergeSort(int arr[], int left, int right){
-    if (left < right){
+/* Sorts src[left..right] into dst[left..right]. Both arrays start out holding the same
+   elements and swap roles at every level, so no level copies its halves before merging */
+void mergeSortInto(int src[], int dst[], int left, int right){
+    STAT_ENTER();
+    if (right - left + 1 <= INSERTION_CUTOFF){
+        insertionSortRange(dst, left, right);
+    } else {
         int mid = left + (right - left) / 2;
-        mergeSort(arr, left, mid);
-        mergeSort(arr, mid + 1, right);
-        merge(arr, left, mid, right);
+        mergeSortInto(dst, src, left, mid);
+        mergeSortInto(dst, src, mid + 1, right);
+        merge(src, dst, left, mid, right);
     }
+    STAT_LEAVE();
+}
+
+/* Top-down merge sort with one scratch buffer allocated for the whole sort */
+void mergeSort(int arr[], int left, int right){
+    if (left >= right) return;
+    int n = right - left + 1;
+    int* buffer = malloc((size_t)n * sizeof(int));
+    if (buffer == NULL){
+        printf("Memory allocation failed!\n");
+        return;
+    }
+
+    memcpy(buffer, arr + left, (size_t)n * sizeof(int));
+    STAT_MOVE(n);
+    mergeSortInto(buffer, arr + left, 0, n - 1);
+    free(buffer);
+}
+
+/* Bottom-up merge sort: insertion sort makes runs of INSERTION_CUTOFF elements,
+   then passes of doubling width merge back and forth between arr and one buffer */
+void mergeSortBottomUp(int arr[], int n){
+    if (n <= 1) return;
+    int* buffer = malloc((size_t)n * sizeof(int));
+    if (buffer == NULL){
+        printf("Memory allocation failed!\n");
+        return;
+    }
+
+    for (int left = 0; left < n; left += INSERTION_CUTOFF){
+        insertionSortRange(arr, left, n - left > INSERTION_CUTOFF ? left + INSERTION_CUTOFF - 1 : n - 1);
+    }
+
+    int *src = arr, *dst = buffer;
+    for (long width = INSERTION_CUTOFF; width < n; width *= 2){
+        for (long left = 0; left < n; left += 2 * width){
+            long mid = left + width - 1 < n - 1 ? left + width - 1 : n - 1;
+            long right = left + 2 * width - 1 < n - 1 ? left + 2 * width - 1 : n - 1;
+            if (mid < right){
+                merge(src, dst, left, mid, right);
+            } else {
+                memcpy(dst + left, src + left, (size_t)(right - left + 1) * sizeof(int));
+                STAT_MOVE(right - left + 1);
+            }
+        }
+        int* temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    if (src != arr){
+        memcpy(arr, src, (size_t)n * sizeof(int));
+        STAT_MOVE(n);
+    }
+    free(buffer);
 }
 
 int main(){
-    int n;
+    int n = 0;
     printf("Enter number of elements: ");
     scanf("%d", &n);
+    if (n < 0) n = 0;
 
-    int orig[n], arr1[n], arr2[n];
+    size_t bytes = (n > 0 ? (size_t)n : 1) * sizeof(int);
+    int *orig = malloc(bytes), *arr1 = malloc(bytes), *arr2 = malloc(bytes), *arr3 = malloc(bytes);
+    if (orig == NULL || arr1 == NULL || arr2 == NULL || arr3 == NULL){
+        printf("Memory allocation failed!\n");
+        free(orig); free(arr1); free(arr2); free(arr3);
+        return 1;
+    }
     
     printf("Enter elements: ");
     for (int i = 0; i < n; i++) scanf("%d", &orig[i]);
     
     copyArray(orig, arr1, n);
     copyArray(orig, arr2, n);
+    copyArray(orig, arr3, n);
     
     printf("\nOriginal: ");
     printArray(orig, n);
     
-    compCount = 0;
-    
     printf("\nQuick Sort:\n");
+    resetStats();
     quickSort(arr1, 0, n - 1);
     printf("Sorted: ");
     printArray(arr1, n);
-    printf("Comparisons: %d\n", compCount);
+    printStats();
     
-    compCount = 0;
     printf("\nMerge Sort:\n");
+    resetStats();
     mergeSort(arr2, 0, n - 1);
     printf("Sorted: ");
     printArray(arr2, n);
-    printf("Comparisons: %d\n", compCount);
+    printStats();
+    
+    printf("\nBottom-Up Merge Sort:\n");
+    resetStats();
+    mergeSortBottomUp(arr3, n);
+    printf("Sorted: ");
+    printArray(arr3, n);
+    printStats();
     
+    free(orig);
+    free(arr1);
+    free(arr2);
+    free(arr3);
     return 0;
 }
@@ -0,0 +1,306 @@
+/*
+ASSIGNMENT 4 (DAG variant):
+Convert an infix expression into an expression DAG instead of a flat postfix string.
+Identical subtrees are hash-consed into one node, constant subexpressions are folded
+while parsing, and the DAG is emitted as stack bytecode (and the matching postfix) in
+which every shared subexpression is evaluated only once.
+Operators and operands follow infix_to_postfix.c: (*, /, +, -, ^), alphabets and digits.
+*/
+
+#include<stdio.h>
+#include<stdlib.h>
+
+#define MAX_SIZE 100
+#define MAX_NODES (2 * MAX_SIZE)
+#define TABLE_SIZE 512
+
+#define OP_CONST 'c'
+#define OP_VAR 'v'
+
+enum { PUSH, LOAD, APPLY, STORE, FETCH };
+
+struct Node {
+    char op;
+    int value;
+    int left, right;
+    int uses;
+    int slot;
+};
+
+struct Instr {
+    int code;
+    int arg;
+};
+
+struct Node nodes[MAX_NODES];
+int nodeCount = 0;
+int table[TABLE_SIZE];
+
+struct Instr code[2 * MAX_NODES];
+int codeLen = 0;
+int slotCount = 0;
+
+int treeNodes = 0, folded = 0;
+
+char opStack[MAX_SIZE];
+int opTop = -1;
+int valStack[MAX_SIZE];
+int valTop = -1;
+
+int priority(char c) {
+    if (c == '+' || c == '-') return 1;
+    if (c == '*' || c == '/') return 2;
+    if (c == '^') return 3;
+    return 0;
+}
+
+/* Returns 0 if the result does not fit in an int */
+int power(int base, int exp, int *result) {
+    int value = 1;
+    while (exp > 0) {
+        if ((exp & 1) && __builtin_mul_overflow(value, base, &value)) return 0;
+        exp >>= 1;
+        if (exp > 0 && __builtin_mul_overflow(base, base, &base)) return 0;
+    }
+    *result = value;
+    return 1;
+}
+
+/* Returns 0 on division by zero, overflow or a negative exponent, leaving *result untouched */
+int apply(char op, int a, int b, int *result) {
+    int r;
+    switch (op) {
+        case '+': if (__builtin_add_overflow(a, b, &r)) return 0; break;
+        case '-': if (__builtin_sub_overflow(a, b, &r)) return 0; break;
+        case '*': if (__builtin_mul_overflow(a, b, &r)) return 0; break;
+        case '/':
+            if (b == 0 || (a == -2147483647 - 1 && b == -1)) return 0;
+            r = a / b;
+            break;
+        case '^':
+            if (b < 0 || !power(a, b, &r)) return 0;
+            break;
+        default:
+            return 0;
+    }
+    *result = r;
+    return 1;
+}
+
+unsigned hashNode(char op, int value, int left, int right) {
+    unsigned h = (unsigned char)op;
+    h = h * 31 + (unsigned)value;
+    h = h * 31 + (unsigned)left;
+    h = h * 31 + (unsigned)right;
+    return (h ^ (h >> 15)) * 2654435761u;
+}
+
+/* Hash-consing constructor: returns the existing node for an identical subtree */
+int makeNode(char op, int value, int left, int right) {
+    treeNodes++;
+
+    if (op != OP_CONST && op != OP_VAR) {
+        if (nodes[left].op == OP_CONST && nodes[right].op == OP_CONST &&
+            apply(op, nodes[left].value, nodes[right].value, &value)) {
+            folded++;
+            op = OP_CONST;
+            left = right = -1;
+        } else if ((op == '+' || op == '*') && left > right) {
+            int t = left; left = right; right = t;
+            value = 0;
+        } else {
+            value = 0;
+        }
+    }
+    if (op == OP_CONST || op == OP_VAR) left = right = -1;
+
+    unsigned index = hashNode(op, value, left, right) & (TABLE_SIZE - 1);
+    while (table[index] != -1) {
+        struct Node *n = &nodes[table[index]];
+        if (n->op == op && n->value == value && n->left == left && n->right == right)
+            return table[index];
+        index = (index + 1) & (TABLE_SIZE - 1);
+    }
+
+    if (nodeCount == MAX_NODES) {
+        printf("Too many nodes\n");
+        exit(1);
+    }
+    int id = nodeCount++;
+    nodes[id].op = op;
+    nodes[id].value = value;
+    nodes[id].left = left;
+    nodes[id].right = right;
+    nodes[id].uses = 0;
+    nodes[id].slot = -1;
+    if (left != -1) nodes[left].uses++;
+    if (right != -1) nodes[right].uses++;
+    table[index] = id;
+    return id;
+}
+
+int reduce() {
+    if (valTop < 1) {
+        printf("Invalid expression: missing operand\n");
+        return 0;
+    }
+    int right = valStack[valTop--];
+    int left = valStack[valTop--];
+    valStack[++valTop] = makeNode(opStack[opTop--], 0, left, right);
+    return 1;
+}
+
+/* Shunting-yard parse that builds DAG nodes instead of postfix characters */
+int buildDag(char infix[]) {
+    for (int i = 0; i < TABLE_SIZE; i++) table[i] = -1;
+
+    int i = 0;
+    char key;
+    while ((key = infix[i++]) != '\0') {
+        if (key >= '0' && key <= '9') {
+            valStack[++valTop] = makeNode(OP_CONST, key - '0', -1, -1);
+        }
+        else if ((key >= 'a' && key <= 'z') || (key >= 'A' && key <= 'Z')) {
+            valStack[++valTop] = makeNode(OP_VAR, key, -1, -1);
+        }
+        else if (key == '*' || key == '/' || key == '+' || key == '-' || key == '^') {
+            while (opTop != -1 && (priority(opStack[opTop]) > priority(key) ||
+                   (key != '^' && priority(opStack[opTop]) == priority(key)))) {
+                if (!reduce()) return -1;
+            }
+            opStack[++opTop] = key;
+        }
+        else if (key == '(') {
+            opStack[++opTop] = key;
+        }
+        else if (key == ')') {
+            while (opTop != -1 && opStack[opTop] != '(') {
+                if (!reduce()) return -1;
+            }
+            if (opTop != -1) opTop--;
+        }
+        else {
+            printf("Invalid character: %c\n", key);
+            return -1;
+        }
+    }
+    while (opTop != -1) {
+        if (opStack[opTop] == '(') { opTop--; continue; }
+        if (!reduce()) return -1;
+    }
+    if (valTop != 0) {
+        printf("Invalid expression\n");
+        return -1;
+    }
+    int root = valStack[valTop--];
+    nodes[root].uses++;
+    return root;
+}
+
+void emit(int n) {
+    struct Node *node = &nodes[n];
+    if (node->slot != -1) {
+        code[codeLen].code = FETCH;
+        code[codeLen++].arg = node->slot;
+        return;
+    }
+    if (node->op == OP_CONST) {
+        code[codeLen].code = PUSH;
+        code[codeLen++].arg = node->value;
+        return;
+    }
+    if (node->op == OP_VAR) {
+        code[codeLen].code = LOAD;
+        code[codeLen++].arg = node->value;
+        return;
+    }
+    emit(node->left);
+    emit(node->right);
+    code[codeLen].code = APPLY;
+    code[codeLen++].arg = node->op;
+    if (node->uses > 1) {
+        node->slot = slotCount++;
+        code[codeLen].code = STORE;
+        code[codeLen++].arg = node->slot;
+    }
+}
+
+void printCode() {
+    printf("Optimized postfix:");
+    for (int i = 0; i < codeLen; i++) {
+        switch (code[i].code) {
+            case PUSH: printf(" %d", code[i].arg); break;
+            case LOAD: printf(" %c", code[i].arg); break;
+            case APPLY: printf(" %c", code[i].arg); break;
+            case STORE: printf(" =t%d", code[i].arg); break;
+            case FETCH: printf(" t%d", code[i].arg); break;
+        }
+    }
+    printf("\n\nBytecode:\n");
+    for (int i = 0; i < codeLen; i++) {
+        printf("%3d: ", i);
+        switch (code[i].code) {
+            case PUSH: printf("PUSH  %d\n", code[i].arg); break;
+            case LOAD: printf("LOAD  %c\n", code[i].arg); break;
+            case APPLY: printf("APPLY %c\n", code[i].arg); break;
+            case STORE: printf("STORE t%d\n", code[i].arg); break;
+            case FETCH: printf("FETCH t%d\n", code[i].arg); break;
+        }
+    }
+}
+
+/* Stack machine for the emitted bytecode; STORE keeps the value on the stack */
+int run(int vars[], int *result) {
+    int stack[MAX_NODES], slots[MAX_NODES];
+    int top = -1;
+    for (int i = 0; i < codeLen; i++) {
+        switch (code[i].code) {
+            case PUSH: stack[++top] = code[i].arg; break;
+            case LOAD: stack[++top] = vars[code[i].arg]; break;
+            case STORE: slots[code[i].arg] = stack[top]; break;
+            case FETCH: stack[++top] = slots[code[i].arg]; break;
+            case APPLY: {
+                int b = stack[top--];
+                int a = stack[top--];
+                char op = (char)code[i].arg;
+                if (!apply(op, a, b, &stack[++top])) {
+                    if (op == '/' && b == 0) printf("Division by zero\n");
+                    else if (op == '^' && b < 0) printf("Negative exponent\n");
+                    else printf("Integer overflow\n");
+                    return 0;
+                }
+                break;
+            }
+        }
+    }
+    *result = stack[top];
+    return 1;
+}
+
+int main() {
+    char infix[MAX_SIZE];
+    printf("Enter infix expression: ");
+    scanf("%s", infix);
+
+    int root = buildDag(infix);
+    if (root == -1) return 1;
+
+    emit(root);
+    printf("Tree nodes: %d, DAG nodes: %d, folded: %d, shared: %d\n",
+           treeNodes, nodeCount, folded, slotCount);
+    printCode();
+
+    int vars[128] = {0};
+    int seen[128] = {0};
+    for (int i = 0; i < codeLen; i++) {
+        if (code[i].code == LOAD && !seen[code[i].arg]) {
+            seen[code[i].arg] = 1;
+            printf("Enter value of %c: ", code[i].arg);
+            scanf("%d", &vars[code[i].arg]);
+        }
+    }
+
+    int result;
+    if (run(vars, &result)) printf("Result: %d\n", result);
+    return 0;
+}
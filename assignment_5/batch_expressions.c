@@ -0,0 +1,402 @@
+/*
+ASSIGNMENT 4/5 (batch driver):
+Convert (infix to postfix) or evaluate (postfix) a whole file of expressions, one per line.
+The input file is memory-mapped and split into chunks on line boundaries. Worker threads
+pick chunks and process them with their own stacks, and the main thread writes each
+chunk's output as soon as it and all chunks before it are done, so output stays in order.
+Chunks aim for at most MAX_CHUNK_SIZE bytes (a single longer line still makes one chunk) and
+workers stay within a window of chunks past the last one written, so output held in memory is
+bounded by the window rather than by the file.
+
+Build: gcc -O2 -pthread batch_expressions.c -o batch_expressions
+Usage: ./batch_expressions convert|eval <input> [output] [threads]
+*/
+
+#define _DEFAULT_SOURCE
+
+#include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
+#include<pthread.h>
+#include<fcntl.h>
+#include<unistd.h>
+#include<sys/mman.h>
+#include<sys/stat.h>
+#include<time.h>
+
+#define CHUNKS_PER_THREAD 8
+#define MIN_CHUNK_SIZE (256 * 1024)
+#define MAX_CHUNK_SIZE (4 * 1024 * 1024)
+
+struct Chunk {
+    const char *start;
+    const char *end;
+    char *out;
+    size_t outLen;
+    size_t outCap;
+    int done;
+};
+
+/* Per-thread stacks, grown to the longest line the worker has seen */
+struct Stack {
+    char *ops;
+    long long *vals;
+    int top;
+    size_t capacity;
+};
+
+struct Batch {
+    struct Chunk *chunks;
+    int chunkCount;
+    int nextChunk;
+    int written;
+    int window;
+    int evaluate;
+    pthread_mutex_t lock;
+    pthread_cond_t chunkDone;
+    pthread_cond_t chunkWritten;
+};
+
+int priority(char c) {
+    if (c == '+' || c == '-') return 1;
+    if (c == '*' || c == '/') return 2;
+    if (c == '^') return 3;
+    return 0;
+}
+
+void reserve(struct Chunk *chunk, size_t extra) {
+    if (chunk->outLen + extra <= chunk->outCap) return;
+    size_t cap = chunk->outCap ? chunk->outCap : 4096;
+    while (cap < chunk->outLen + extra) cap *= 2;
+    chunk->out = realloc(chunk->out, cap);
+    if (chunk->out == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    chunk->outCap = cap;
+}
+
+void appendText(struct Chunk *chunk, const char *text) {
+    size_t len = strlen(text);
+    reserve(chunk, len);
+    memcpy(chunk->out + chunk->outLen, text, len);
+    chunk->outLen += len;
+}
+
+void fitStack(struct Stack *s, size_t len) {
+    if (len <= s->capacity) return;
+    s->ops = realloc(s->ops, len);
+    s->vals = realloc(s->vals, len * sizeof(long long));
+    if (s->ops == NULL || s->vals == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    s->capacity = len;
+}
+
+/* Same rules as infix_to_postfix.c, writing straight into the chunk output */
+void convertLine(const char *line, size_t len, struct Stack *s, struct Chunk *chunk) {
+    size_t mark = chunk->outLen;
+    reserve(chunk, len + 1);
+    char *postfix = chunk->out + chunk->outLen;
+    size_t index = 0;
+    s->top = -1;
+
+    for (size_t i = 0; i < len; i++) {
+        char key = line[i];
+        if ((key >= '0' && key <= '9') || (key >= 'a' && key <= 'z') || (key >= 'A' && key <= 'Z')) {
+            postfix[index++] = key;
+        }
+        else if (key == '*' || key == '/' || key == '+' || key == '-' || key == '^') {
+            if (key == '^') {
+                while (s->top != -1 && priority(s->ops[s->top]) > priority(key))
+                    postfix[index++] = s->ops[s->top--];
+            } else {
+                while (s->top != -1 && priority(s->ops[s->top]) >= priority(key))
+                    postfix[index++] = s->ops[s->top--];
+            }
+            s->ops[++s->top] = key;
+        }
+        else if (key == '(') {
+            s->ops[++s->top] = key;
+        }
+        else if (key == ')') {
+            while (s->top != -1 && s->ops[s->top] != '(')
+                postfix[index++] = s->ops[s->top--];
+            if (s->top != -1) s->top--;
+        }
+        else {
+            char msg[32];
+            chunk->outLen = mark;
+            snprintf(msg, sizeof(msg), "Invalid character: %c\n", key);
+            appendText(chunk, msg);
+            return;
+        }
+    }
+    while (s->top != -1) {
+        if (s->ops[s->top] != '(') postfix[index++] = s->ops[s->top];
+        s->top--;
+    }
+    postfix[index++] = '\n';
+    chunk->outLen += index;
+}
+
+/* Same rules as postfix_evaluation.c in its default build: operands are single digits unless the
+   line contains whitespace, and 64-bit arithmetic stops on overflow */
+void evaluateLine(const char *line, size_t len, struct Stack *s, struct Chunk *chunk) {
+    char msg[64];
+    int multiDigit = memchr(line, ' ', len) != NULL || memchr(line, '\t', len) != NULL;
+    s->top = -1;
+
+    for (size_t i = 0; i < len;) {
+        char c = line[i];
+        if (c == ' ' || c == '\t') {
+            i++;
+            continue;
+        }
+        if (c >= '0' && c <= '9') {
+            long long value = line[i++] - '0';
+            while (multiDigit && i < len && line[i] >= '0' && line[i] <= '9') {
+                if (__builtin_mul_overflow(value, 10, &value) ||
+                    __builtin_add_overflow(value, line[i++] - '0', &value)) {
+                    appendText(chunk, "Operand too large for 64-bit arithmetic\n");
+                    return;
+                }
+            }
+            s->vals[++s->top] = value;
+            continue;
+        }
+        i++;
+        if (s->top < 1) {
+            appendText(chunk, "Stack Underflow\n");
+            return;
+        }
+        long long b = s->vals[s->top--];
+        long long a = s->vals[s->top];
+        int overflow;
+        switch (c) {
+            case '+': overflow = __builtin_add_overflow(a, b, &s->vals[s->top]); break;
+            case '-': overflow = __builtin_sub_overflow(a, b, &s->vals[s->top]); break;
+            case '*': overflow = __builtin_mul_overflow(a, b, &s->vals[s->top]); break;
+            case '/':
+                if (b == 0) {
+                    appendText(chunk, "Division by zero\n");
+                    return;
+                }
+                overflow = a == -__LONG_LONG_MAX__ - 1 && b == -1;
+                if (!overflow) s->vals[s->top] = a / b;
+                break;
+            default:
+                snprintf(msg, sizeof(msg), "Invalid operator: %c\n", c);
+                appendText(chunk, msg);
+                return;
+        }
+        if (overflow) {
+            snprintf(msg, sizeof(msg), "Overflow in 64-bit arithmetic at operator %c\n", c);
+            appendText(chunk, msg);
+            return;
+        }
+    }
+    if (s->top == -1) {
+        appendText(chunk, "Stack Underflow\n");
+        return;
+    }
+    snprintf(msg, sizeof(msg), "%lld\n", s->vals[s->top]);
+    appendText(chunk, msg);
+}
+
+void processChunk(struct Batch *batch, struct Chunk *chunk, struct Stack *s) {
+    const char *p = chunk->start;
+    while (p < chunk->end) {
+        const char *nl = memchr(p, '\n', chunk->end - p);
+        const char *lineEnd = nl ? nl : chunk->end;
+        size_t len = lineEnd - p;
+        if (len > 0 && p[len - 1] == '\r') len--;
+
+        fitStack(s, len + 1);
+        if (batch->evaluate) evaluateLine(p, len, s, chunk);
+        else convertLine(p, len, s, chunk);
+
+        p = lineEnd + 1;
+    }
+}
+
+void *worker(void *arg) {
+    struct Batch *batch = arg;
+    struct Stack s = {NULL, NULL, -1, 0};
+
+    while (1) {
+        int i = __atomic_fetch_add(&batch->nextChunk, 1, __ATOMIC_RELAXED);
+        if (i >= batch->chunkCount) break;
+
+        pthread_mutex_lock(&batch->lock);
+        while (i >= batch->written + batch->window)
+            pthread_cond_wait(&batch->chunkWritten, &batch->lock);
+        pthread_mutex_unlock(&batch->lock);
+
+        processChunk(batch, &batch->chunks[i], &s);
+
+        pthread_mutex_lock(&batch->lock);
+        batch->chunks[i].done = 1;
+        pthread_cond_broadcast(&batch->chunkDone);
+        pthread_mutex_unlock(&batch->lock);
+    }
+
+    free(s.ops);
+    free(s.vals);
+    return NULL;
+}
+
+/* Cut [data, data+size) into chunks of about size / wanted bytes, within
+   [MIN_CHUNK_SIZE, MAX_CHUNK_SIZE], that end just after a newline */
+int splitChunks(const char *data, size_t size, int wanted, struct Chunk **out) {
+    size_t target = size / wanted;
+    if (target < MIN_CHUNK_SIZE) target = MIN_CHUNK_SIZE;
+    if (target > MAX_CHUNK_SIZE) target = MAX_CHUNK_SIZE;
+
+    /* Every chunk but the last is at least target bytes long */
+    size_t capacity = size / target + 1;
+    if (capacity > 2147483647) return -1;
+    struct Chunk *chunks = calloc(capacity, sizeof(struct Chunk));
+    if (chunks == NULL) return -1;
+
+    int count = 0;
+    const char *p = data, *end = data + size;
+    while (p < end) {
+        const char *cut = p + target < end ? p + target : end;
+        if (cut < end) {
+            const char *nl = memchr(cut, '\n', end - cut);
+            cut = nl ? nl + 1 : end;
+        }
+        chunks[count].start = p;
+        chunks[count].end = cut;
+        count++;
+        p = cut;
+    }
+    *out = chunks;
+    return count;
+}
+
+int writeAll(int fd, const char *buf, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, buf, len);
+        if (n < 0) return 0;
+        buf += n;
+        len -= n;
+    }
+    return 1;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 3 || (strcmp(argv[1], "convert") != 0 && strcmp(argv[1], "eval") != 0)) {
+        printf("Usage: %s convert|eval <input> [output] [threads]\n", argv[0]);
+        return 1;
+    }
+
+    int in = open(argv[2], O_RDONLY);
+    if (in < 0) {
+        perror("Cannot open input");
+        return 1;
+    }
+    struct stat st;
+    if (fstat(in, &st) != 0) {
+        perror("Cannot stat input");
+        close(in);
+        return 1;
+    }
+    if (st.st_size == 0) {
+        close(in);
+        return 0;
+    }
+
+    const char *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, in, 0);
+    if (data == MAP_FAILED) {
+        perror("mmap failed");
+        return 1;
+    }
+    madvise((void *)data, st.st_size, MADV_SEQUENTIAL);
+
+    int out = STDOUT_FILENO;
+    if (argc > 3 && strcmp(argv[3], "-") != 0) {
+        out = open(argv[3], O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (out < 0) {
+            perror("Cannot open output");
+            return 1;
+        }
+    }
+
+    int threads = argc > 4 ? atoi(argv[4]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads < 1) threads = 1;
+
+    struct Batch batch;
+    batch.evaluate = strcmp(argv[1], "eval") == 0;
+    batch.nextChunk = 0;
+    batch.written = 0;
+    batch.window = 2 * threads;
+    batch.chunkCount = splitChunks(data, st.st_size, threads * CHUNKS_PER_THREAD, &batch.chunks);
+    if (batch.chunkCount < 0) {
+        printf("Memory allocation failed\n");
+        return 1;
+    }
+    pthread_mutex_init(&batch.lock, NULL);
+    pthread_cond_init(&batch.chunkDone, NULL);
+    pthread_cond_init(&batch.chunkWritten, NULL);
+
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+
+    /* Whatever threads fail to start are simply missing; with none, the main thread does the work */
+    pthread_t *tids = malloc(threads * sizeof(pthread_t));
+    int started = 0;
+    while (tids != NULL && started < threads && pthread_create(&tids[started], NULL, worker, &batch) == 0)
+        started++;
+    if (started < threads)
+        fprintf(stderr, "Started %d of %d worker threads\n", started, threads);
+
+    struct Stack inlineStack = {NULL, NULL, -1, 0};
+    int ok = 1;
+    for (int i = 0; i < batch.chunkCount; i++) {
+        struct Chunk *chunk = &batch.chunks[i];
+        if (started == 0) {
+            processChunk(&batch, chunk, &inlineStack);
+        } else {
+            pthread_mutex_lock(&batch.lock);
+            while (!chunk->done)
+                pthread_cond_wait(&batch.chunkDone, &batch.lock);
+            pthread_mutex_unlock(&batch.lock);
+        }
+
+        if (ok && !writeAll(out, chunk->out, chunk->outLen)) {
+            perror("Write failed");
+            ok = 0;
+        }
+        free(chunk->out);
+        chunk->out = NULL;
+
+        pthread_mutex_lock(&batch.lock);
+        batch.written = i + 1;
+        pthread_cond_broadcast(&batch.chunkWritten);
+        pthread_mutex_unlock(&batch.lock);
+    }
+
+    for (int i = 0; i < started; i++)
+        pthread_join(tids[i], NULL);
+    free(inlineStack.ops);
+    free(inlineStack.vals);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    double secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+    fprintf(stderr, "%s: %lld bytes, %d chunks, %d threads, %.3f s (%.1f MB/s)\n",
+            argv[1], (long long)st.st_size, batch.chunkCount, started, secs,
+            st.st_size / secs / 1e6);
+
+    free(tids);
+    free(batch.chunks);
+    pthread_mutex_destroy(&batch.lock);
+    pthread_cond_destroy(&batch.chunkDone);
+    pthread_cond_destroy(&batch.chunkWritten);
+    munmap((void *)data, st.st_size);
+    close(in);
+    if (out != STDOUT_FILENO) close(out);
+    return ok ? 0 : 1;
+}
@@ -1,56 +1,159 @@
 /*
 ASSIGNMENT 5:
 Problem Statement: Write a C program to evaluate a given postfix expression.
-Assume that there are only four operators (*, /, +, -) in a postfix expression and operand is single digit only.
+Assume that there are only four operators (*, /, +, -) in a postfix expression.
+Operands are single digits when the expression has no spaces (e.g. 23+4*); with whitespace-separated
+tokens they can have any number of digits (e.g. 120 35 + 4 *). Arithmetic is 64-bit (or 128-bit) integer: an operand or
+result that does not fit stops the evaluation with a message, or saturates with -DEVAL_SATURATE.
 */
 
 #include<stdio.h>
 #include<stdlib.h>
+#include<string.h>
+
+/*
+Build options:
+  -DEVAL_BITS=64 (default) or -DEVAL_BITS=128 selects the integer width.
+  -DEVAL_SATURATE clamps overflowing results to the min/max value instead of stopping.
+*/
+#ifndef EVAL_BITS
+#define EVAL_BITS 64
+#endif
+
+#if EVAL_BITS == 128
+typedef __int128 value_t;
+#define VALUE_MAX ((value_t)(((unsigned __int128)1 << 127) - 1))
+#elif EVAL_BITS == 64
+typedef long long value_t;
+#define VALUE_MAX ((value_t)__LONG_LONG_MAX__)
+#else
+#error "EVAL_BITS must be 64 or 128"
+#endif
+#define VALUE_MIN (-VALUE_MAX - 1)
 
 #define SIZE 100
-int stack[SIZE];
+#define MAX_EXPR 1024
+value_t stack[SIZE];
 int top = -1;
 
-char pop() {
+int pop(value_t *value) {
     if (top == -1) {
         printf("Stack Underflow - cannot pop\n");
-        return '\0';
+        return 0;
     }
-    return stack[top--];
+    *value = stack[top--];
+    return 1;
 }
 
-void push(char c) {
+int push(value_t value) {
     if (top == SIZE - 1) {
-        printf("Stack Overflow - cannot push %c\n", c);
-        return;
+        printf("Stack Overflow - cannot push\n");
+        return 0;
     }
-    stack[++top] = c;
+    stack[++top] = value;
+    return 1;
+}
+
+void printValue(value_t value) {
+    char digits[48];
+    int n = 0;
+    unsigned __int128 magnitude = value < 0 ? -(unsigned __int128)value : (unsigned __int128)value;
+    do {
+        digits[n++] = '0' + (int)(magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+    if (value < 0) putchar('-');
+    while (n > 0) putchar(digits[--n]);
+}
+
+/* Saturated result for an overflowing a op b, chosen from the sign of the true result */
+value_t saturate(char op, value_t a, value_t b) {
+    int negative;
+    switch (op) {
+        case '+': negative = b < 0; break;
+        case '-': negative = b > 0; break;
+        case '*': negative = (a < 0) != (b < 0); break;
+        default: negative = 0; break;
+    }
+    return negative ? VALUE_MIN : VALUE_MAX;
+}
+
+/* Returns 0 if the operation cannot produce a result */
+int applyOperator(char op, value_t a, value_t b, value_t *result) {
+    int overflow;
+    switch (op) {
+        case '+': overflow = __builtin_add_overflow(a, b, result); break;
+        case '-': overflow = __builtin_sub_overflow(a, b, result); break;
+        case '*': overflow = __builtin_mul_overflow(a, b, result); break;
+        case '/':
+            if (b == 0) {
+                printf("Division by zero\n");
+                return 0;
+            }
+            overflow = a == VALUE_MIN && b == -1;
+            if (!overflow) *result = a / b;
+            break;
+        default:
+            printf("Invalid operator: %c\n", op);
+            return 0;
+    }
+    if (__builtin_expect(overflow, 0)) {
+#ifdef EVAL_SATURATE
+        *result = saturate(op, a, b);
+#else
+        printf("Overflow in %d-bit arithmetic at operator %c\n", EVAL_BITS, op);
+        return 0;
+#endif
+    }
+    return 1;
+}
+
+int readOperand(char *postfix, int *i, int multiDigit, value_t *value) {
+    *value = postfix[(*i)++] - '0';
+    while (multiDigit && postfix[*i] >= '0' && postfix[*i] <= '9') {
+        if (__builtin_mul_overflow(*value, 10, value) ||
+            __builtin_add_overflow(*value, postfix[(*i)++] - '0', value)) {
+#ifdef EVAL_SATURATE
+            *value = VALUE_MAX;
+            while (postfix[*i] >= '0' && postfix[*i] <= '9') (*i)++;
+#else
+            printf("Operand too large for %d-bit arithmetic\n", EVAL_BITS);
+            return 0;
+#endif
+        }
+    }
+    return 1;
 }
 
 void evaluate(char *postfix) {
-    for (int i = 0; postfix[i] != '\0'; i++) {
+    int multiDigit = strchr(postfix, ' ') != NULL || strchr(postfix, '\t') != NULL;
+    value_t a, b, result;
+    top = -1;
+
+    for (int i = 0; postfix[i] != '\0';) {
         char c = postfix[i];
-        if (c >= '0' && c <= '9') {
-            push(c - '0'); 
+        if (c == ' ' || c == '\t') {
+            i++;
+        } else if (c >= '0' && c <= '9') {
+            if (!readOperand(postfix, &i, multiDigit, &result) || !push(result)) return;
         } else {
-            int b = pop();
-            int a = pop();
-            switch (c) {
-                case '+': push(a + b); break;
-                case '-': push(a - b); break;
-                case '*': push(a * b); break;
-                case '/': push(a / b); break;
-                default: printf("Invalid operator: %c\n", c);
-            }
+            i++;
+            if (!pop(&b) || !pop(&a)) return;
+            if (!applyOperator(c, a, b, &result)) return;
+            push(result);
         }
     }
-    printf("Result: %d\n", pop());
+    if (!pop(&result)) return;
+    printf("Result: ");
+    printValue(result);
+    printf("\n");
 }
 
 int main() {
-    char postfix[SIZE];
+    char postfix[MAX_EXPR];
     printf("Enter postfix expression: ");
-    scanf("%s", postfix);
+    if (fgets(postfix, MAX_EXPR, stdin) == NULL) return 0;
+    postfix[strcspn(postfix, "\r\n")] = '\0';
     evaluate(postfix);
     return 0;
-}
\ No newline at end of file
+}
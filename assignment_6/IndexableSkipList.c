@@ -0,0 +1,456 @@
+/*
+ASSIGNMENT 6 (indexable skip list variant):
+Same menu as SinglyLinkedList.c, backed by an indexable skip list.
+Every link stores its width (how many positions it skips), so the node at position k is
+found in O(log n) and insert/delete at position k cost O(log n) instead of a linear walk.
+Reverse flips a view flag instead of relinking, and search descends by value in O(log n)
+whenever the list is currently ordered (ascending or descending), falling back to a scan otherwise.
+*/
+
+#include<stdio.h>
+#include<stdlib.h>
+#include<unistd.h>
+
+#define MAX_LEVEL 16
+
+struct Link{
+    struct Node *next;
+    int width;
+};
+
+struct Node{
+    int data;
+    int level;
+    struct Link links[];
+};
+
+struct SkipList{
+    struct Node *head;
+    int level;
+    int length;
+    int reversed;
+    int descents;
+    int ascents;
+    unsigned seed;
+};
+
+struct SkipList* createList(){
+    struct SkipList *list = malloc(sizeof(struct SkipList));
+    struct Node *head = malloc(sizeof(struct Node) + MAX_LEVEL * sizeof(struct Link));
+    if (list == NULL || head == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    for (int i = 0; i < MAX_LEVEL; i++) {
+        head->links[i].next = NULL;
+        head->links[i].width = 0;
+    }
+    head->level = MAX_LEVEL;
+    list->head = head;
+    list->level = 1;
+    list->length = 0;
+    list->reversed = 0;
+    list->descents = 0;
+    list->ascents = 0;
+    list->seed = 2463534242u;
+    return list;
+}
+
+/* Each level is kept with probability 1/4, which needs 4^16 elements to fill MAX_LEVEL */
+int randomLevel(struct SkipList *list){
+    unsigned x = list->seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    list->seed = x;
+    int level = 1 + __builtin_ctz(x | (1u << 30)) / 2;
+    return level < MAX_LEVEL ? level : MAX_LEVEL;
+}
+
+/* Pair (a, b) of adjacent values: counts how often the list goes down or up */
+void countPair(struct SkipList *list, struct Node *a, struct Node *b, int sign){
+    if (a == list->head || b == NULL) return;
+    if (a->data > b->data) list->descents += sign;
+    if (a->data < b->data) list->ascents += sign;
+}
+
+/* Maps a position as the user sees it to the position in the stored order */
+int physical(struct SkipList *list, int k, int inserting){
+    if (!list->reversed) return k;
+    return list->length - k + 1 + inserting;
+}
+
+/* Fills update[] with the last node before rank and rank[] with their positions */
+void findPredecessors(struct SkipList *list, int position, struct Node *update[], int rank[]){
+    struct Node *x = list->head;
+    int traversed = 0;
+    for (int i = list->level - 1; i >= 0; i--) {
+        while (x->links[i].next != NULL && traversed + x->links[i].width < position) {
+            traversed += x->links[i].width;
+            x = x->links[i].next;
+        }
+        update[i] = x;
+        rank[i] = traversed;
+    }
+}
+
+struct Node* nodeAt(struct SkipList *list, int position){
+    struct Node *x = list->head;
+    int traversed = 0;
+    for (int i = list->level - 1; i >= 0; i--) {
+        while (x->links[i].next != NULL && traversed + x->links[i].width <= position) {
+            traversed += x->links[i].width;
+            x = x->links[i].next;
+        }
+        if (traversed == position) return x;
+    }
+    return NULL;
+}
+
+void insertPhysical(struct SkipList *list, int value, int position){
+    struct Node *update[MAX_LEVEL];
+    int rank[MAX_LEVEL];
+    findPredecessors(list, position, update, rank);
+
+    int level = randomLevel(list);
+    struct Node *newNode = malloc(sizeof(struct Node) + level * sizeof(struct Link));
+    if (newNode == NULL) {
+        printf("Memory allocation failed!\n");
+        return;
+    }
+    newNode->data = value;
+    newNode->level = level;
+
+    if (level > list->level) {
+        for (int i = list->level; i < level; i++) {
+            update[i] = list->head;
+            rank[i] = 0;
+            list->head->links[i].width = list->length;
+        }
+        list->level = level;
+    }
+
+    countPair(list, update[0], update[0]->links[0].next, -1);
+    for (int i = 0; i < level; i++) {
+        newNode->links[i].next = update[i]->links[i].next;
+        update[i]->links[i].next = newNode;
+        newNode->links[i].width = update[i]->links[i].width - (rank[0] - rank[i]);
+        update[i]->links[i].width = rank[0] - rank[i] + 1;
+    }
+    for (int i = level; i < list->level; i++) {
+        update[i]->links[i].width++;
+    }
+    countPair(list, update[0], newNode, 1);
+    countPair(list, newNode, newNode->links[0].next, 1);
+    list->length++;
+}
+
+int deletePhysical(struct SkipList *list, int position){
+    struct Node *update[MAX_LEVEL];
+    int rank[MAX_LEVEL];
+    findPredecessors(list, position, update, rank);
+
+    struct Node *x = update[0]->links[0].next;
+    int value = x->data;
+
+    countPair(list, update[0], x, -1);
+    countPair(list, x, x->links[0].next, -1);
+    countPair(list, update[0], x->links[0].next, 1);
+    for (int i = 0; i < list->level; i++) {
+        if (update[i]->links[i].next == x) {
+            update[i]->links[i].width += x->links[i].width - 1;
+            update[i]->links[i].next = x->links[i].next;
+        } else {
+            update[i]->links[i].width--;
+        }
+    }
+    while (list->level > 1 && list->head->links[list->level - 1].next == NULL) {
+        list->level--;
+    }
+    list->length--;
+    free(x);
+    return value;
+}
+
+void insertAtBeginning(struct SkipList *list, int value){
+    insertPhysical(list, value, physical(list, 1, 1));
+    printf("Inserted %d at beginning\n", value);
+}
+
+void insertAtEnd(struct SkipList *list, int value){
+    insertPhysical(list, value, physical(list, list->length + 1, 1));
+    printf("Inserted %d at end\n", value);
+}
+
+void insertAtK(struct SkipList *list, int value, int k){
+    if (k <= 0) {
+        printf("Invalid position! Position should be >= 1\n");
+        return;
+    }
+    if (k > list->length + 1) {
+        printf("Position %d is out of bounds\n", k);
+        return;
+    }
+    if (k == 1) {
+        insertAtBeginning(list, value);
+        return;
+    }
+    insertPhysical(list, value, physical(list, k, 1));
+    printf("Inserted %d at position %d\n", value, k);
+}
+
+void deleteFromBeginning(struct SkipList *list){
+    if (list->length == 0) {
+        printf("List is empty! Nothing to delete\n");
+        return;
+    }
+    printf("Deleted %d from beginning\n", deletePhysical(list, physical(list, 1, 0)));
+}
+
+void deleteFromEnd(struct SkipList *list){
+    if (list->length == 0) {
+        printf("List is empty! Nothing to delete\n");
+        return;
+    }
+    printf("Deleted %d from end\n", deletePhysical(list, physical(list, list->length, 0)));
+}
+
+void deleteFromK(struct SkipList *list, int k){
+    if (list->length == 0) {
+        printf("List is empty! Nothing to delete\n");
+        return;
+    }
+    if (k <= 0) {
+        printf("Invalid position! Position should be >= 1\n");
+        return;
+    }
+    if (k > list->length) {
+        printf("Position %d is out of bounds\n", k);
+        return;
+    }
+    if (k == 1) {
+        deleteFromBeginning(list);
+        return;
+    }
+    printf("Deleted %d from position %d\n", deletePhysical(list, physical(list, k, 0)), k);
+}
+
+/* Output for the display functions is built in a 4 KB chunk local to each call: numbers are
+   converted by hand and every full chunk goes out in one write() instead of one printf per node */
+#define OUT_CHUNK 4096
+
+struct Output {
+    char text[OUT_CHUNK];
+    size_t used;
+};
+
+void outFlush(struct Output *out) {
+    size_t done = 0;
+    fflush(stdout);
+    while (done < out->used) {
+        ssize_t n = write(STDOUT_FILENO, out->text + done, out->used - done);
+        if (n <= 0) break;
+        done += n;
+    }
+    out->used = 0;
+}
+
+void outText(struct Output *out, const char *text) {
+    while (*text != '\0') {
+        if (out->used == OUT_CHUNK) outFlush(out);
+        out->text[out->used++] = *text++;
+    }
+}
+
+void outInt(struct Output *out, int value) {
+    char digits[12];
+    int n = 0;
+    unsigned magnitude = value < 0 ? 0u - (unsigned)value : (unsigned)value;
+    if (out->used + sizeof(digits) > OUT_CHUNK) outFlush(out);
+    do {
+        digits[n++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude != 0);
+    if (value < 0) out->text[out->used++] = '-';
+    while (n > 0) out->text[out->used++] = digits[--n];
+}
+
+void display(struct SkipList *list){
+    if (list->length == 0) {
+        printf("List is empty\n");
+        return;
+    }
+
+    struct Output out;
+    out.used = 0;
+    outText(&out, "List: ");
+    if (!list->reversed) {
+        for (struct Node *x = list->head->links[0].next; x != NULL; x = x->links[0].next) {
+            outInt(&out, x->data);
+            if (x->links[0].next != NULL) outText(&out, " -> ");
+        }
+    } else {
+        int *values = malloc(list->length * sizeof(int));
+        if (values == NULL) {
+            printf("Memory allocation failed!\n");
+            return;
+        }
+        int n = 0;
+        for (struct Node *x = list->head->links[0].next; x != NULL; x = x->links[0].next) {
+            values[n++] = x->data;
+        }
+        while (n > 0) {
+            outInt(&out, values[--n]);
+            if (n > 0) outText(&out, " -> ");
+        }
+        free(values);
+    }
+    outText(&out, "\n");
+    outFlush(&out);
+}
+
+/* Number of stored nodes that come before value in an ordered list (ascending if dir > 0) */
+int countBefore(struct SkipList *list, int value, int dir, int inclusive){
+    struct Node *x = list->head;
+    int traversed = 0;
+    for (int i = list->level - 1; i >= 0; i--) {
+        while (x->links[i].next != NULL) {
+            int d = x->links[i].next->data;
+            int before = dir > 0 ? (d < value || (inclusive && d == value))
+                                 : (d > value || (inclusive && d == value));
+            if (!before) break;
+            traversed += x->links[i].width;
+            x = x->links[i].next;
+        }
+    }
+    return traversed;
+}
+
+void search(struct SkipList *list, int value){
+    int position = 0;
+
+    if (list->length > 0 && (list->descents == 0 || list->ascents == 0)) {
+        int dir = list->descents == 0 ? 1 : -1;
+        int p = list->reversed ? countBefore(list, value, dir, 1) : countBefore(list, value, dir, 0) + 1;
+        struct Node *x = nodeAt(list, p);
+        if (x != NULL && x != list->head && x->data == value) {
+            position = list->reversed ? list->length - p + 1 : p;
+        }
+    } else {
+        int p = 1;
+        for (struct Node *x = list->head->links[0].next; x != NULL; x = x->links[0].next, p++) {
+            if (x->data == value) {
+                position = list->reversed ? list->length - p + 1 : p;
+                if (!list->reversed) break;
+            }
+        }
+    }
+
+    if (position > 0) printf("Value %d found at position %d\n", value, position);
+    else printf("Value %d not found in the list\n", value);
+}
+
+void reverse(struct SkipList *list){
+    if (list->length == 0) {
+        printf("List is empty! Nothing to reverse\n");
+        return;
+    }
+    list->reversed = !list->reversed;
+    printf("List reversed successfully\n");
+}
+
+void freeList(struct SkipList *list){
+    struct Node *x = list->head;
+    while (x != NULL) {
+        struct Node *temp = x;
+        x = x->links[0].next;
+        free(temp);
+    }
+    free(list);
+}
+
+void displayMenu(){
+    printf("\n===== SKIP LIST MENU =====\n");
+    printf("1. Insert at beginning\n");
+    printf("2. Insert at end\n");
+    printf("3. Insert at position k\n");
+    printf("4. Delete from beginning\n");
+    printf("5. Delete from end\n");
+    printf("6. Delete from position k\n");
+    printf("7. Display list\n");
+    printf("8. Search for value\n");
+    printf("9. Reverse list\n");
+    printf("0. Quit\n");
+    printf("==========================\n");
+    printf("Enter your choice: ");
+}
+
+int main(){
+    struct SkipList *list = createList();
+    int choice, value, position;
+
+    while (1) {
+        displayMenu();
+        scanf("%d", &choice);
+
+        switch (choice) {
+            case 1:
+                printf("Enter value to insert at beginning: ");
+                scanf("%d", &value);
+                insertAtBeginning(list, value);
+                break;
+
+            case 2:
+                printf("Enter value to insert at end: ");
+                scanf("%d", &value);
+                insertAtEnd(list, value);
+                break;
+
+            case 3:
+                printf("Enter value to insert: ");
+                scanf("%d", &value);
+                printf("Enter position (1-indexed): ");
+                scanf("%d", &position);
+                insertAtK(list, value, position);
+                break;
+
+            case 4:
+                deleteFromBeginning(list);
+                break;
+
+            case 5:
+                deleteFromEnd(list);
+                break;
+
+            case 6:
+                printf("Enter position to delete (1-indexed): ");
+                scanf("%d", &position);
+                deleteFromK(list, position);
+                break;
+
+            case 7:
+                display(list);
+                break;
+
+            case 8:
+                printf("Enter value to search: ");
+                scanf("%d", &value);
+                search(list, value);
+                break;
+
+            case 9:
+                reverse(list);
+                break;
+
+            case 0:
+                freeList(list);
+                exit(0);
+
+            default:
+                printf("Invalid choice! Please enter a number between 0-9\n");
+                break;
+        }
+    }
+
+    return 0;
+}
@@ -13,117 +13,422 @@ Problem Statement: Write a menu driven program in C to perform the following ope
 
 #include<stdio.h>
 #include<stdlib.h>
+#include<unistd.h>
 
 struct Node{
     int data;
     struct Node *next;
+    struct IndexLink *link;
 };
 
-void insertAtBeginning(struct Node **head, int value){
-    struct Node* newNode = malloc(sizeof(struct Node));
+#define FIRST_BLOCK_NODES 32
+#define MAX_BLOCK_NODES 65536
+
+/* Nodes are carved out of blocks that grow geometrically up to MAX_BLOCK_NODES */
+struct NodeBlock{
+    struct NodeBlock *next;
+    int capacity;
+    struct Node nodes[];
+};
+
+struct NodeArena{
+    struct NodeBlock *blocks;
+    int used;
+    struct Node *freeList;
+};
+
+/* Optional value index: a hash multimap from value to the nodes holding it. Each distinct value
+   keeps a chain of links in list order and every node points at its own link, so adding or
+   removing a node is O(1) and the first node holding a value is found without a scan */
+struct IndexLink{
+    struct Node *node;
+    struct IndexLink *prev;
+    struct IndexLink *next;
+};
+
+struct IndexEntry{
+    int value;
+    struct IndexLink *first;
+    struct IndexLink *last;
+    struct IndexEntry *next;
+};
+
+struct ValueIndex{
+    struct IndexEntry **buckets;
+    int bucketCount;
+    int count;
+};
+
+int indexEnabled(struct ValueIndex *index){
+    return index->buckets != NULL;
+}
+
+unsigned indexSlot(struct ValueIndex *index, int value){
+    unsigned h = (unsigned)value * 2654435761u;
+    return (h ^ (h >> 16)) & (index->bucketCount - 1);
+}
+
+int indexResize(struct ValueIndex *index, int bucketCount){
+    struct IndexEntry **buckets = calloc(bucketCount, sizeof(struct IndexEntry *));
+    if (buckets == NULL) {
+        printf("Memory allocation failed!\n");
+        return 0;
+    }
+    struct IndexEntry **old = index->buckets;
+    int oldCount = index->bucketCount;
+    index->buckets = buckets;
+    index->bucketCount = bucketCount;
+    for (int i = 0; i < oldCount; i++) {
+        while (old[i] != NULL) {
+            struct IndexEntry *entry = old[i];
+            old[i] = entry->next;
+            unsigned slot = indexSlot(index, entry->value);
+            entry->next = buckets[slot];
+            buckets[slot] = entry;
+        }
+    }
+    free(old);
+    return 1;
+}
+
+struct IndexEntry* indexLookup(struct ValueIndex *index, int value){
+    struct IndexEntry *entry = index->buckets[indexSlot(index, value)];
+    while (entry != NULL && entry->value != value){
+        entry = entry->next;
+    }
+    return entry;
+}
+
+void indexFree(struct ValueIndex *index){
+    for (int i = 0; i < index->bucketCount; i++) {
+        while (index->buckets[i] != NULL) {
+            struct IndexEntry *entry = index->buckets[i];
+            index->buckets[i] = entry->next;
+            while (entry->first != NULL) {
+                struct IndexLink *link = entry->first;
+                entry->first = link->next;
+                link->node->link = NULL;
+                free(link);
+            }
+            free(entry);
+        }
+    }
+    free(index->buckets);
+    index->buckets = NULL;
+    index->bucketCount = 0;
+    index->count = 0;
+}
+
+/* An index missing a node would give wrong answers, so running out of memory turns it off */
+void indexFail(struct ValueIndex *index){
+    indexFree(index);
+    printf("Memory allocation failed! Value index disabled\n");
+}
+
+/* Adds node to its value's chain right after sameBefore, the nearest earlier node holding the
+   same value, or at the front of the chain when there is none */
+void indexAdd(struct ValueIndex *index, struct Node *node, struct Node *sameBefore){
+    if (!indexEnabled(index)) return;
+    struct IndexEntry *entry = indexLookup(index, node->data);
+    if (entry == NULL){
+        if (index->count >= index->bucketCount && !indexResize(index, index->bucketCount * 2)){
+            indexFail(index);
+            return;
+        }
+        entry = malloc(sizeof(struct IndexEntry));
+        if (entry == NULL){
+            indexFail(index);
+            return;
+        }
+        unsigned slot = indexSlot(index, node->data);
+        entry->value = node->data;
+        entry->first = entry->last = NULL;
+        entry->next = index->buckets[slot];
+        index->buckets[slot] = entry;
+        index->count++;
+    }
+    struct IndexLink *link = malloc(sizeof(struct IndexLink));
+    if (link == NULL){
+        indexFail(index);
+        return;
+    }
+    link->node = node;
+    link->prev = sameBefore != NULL ? sameBefore->link : NULL;
+    link->next = link->prev != NULL ? link->prev->next : entry->first;
+    if (link->prev != NULL) link->prev->next = link;
+    else entry->first = link;
+    if (link->next != NULL) link->next->prev = link;
+    else entry->last = link;
+    node->link = link;
+}
+
+/* The last node holding value, which a node appended with that value follows in its chain */
+struct Node* indexLast(struct ValueIndex *index, int value){
+    if (!indexEnabled(index)) return NULL;
+    struct IndexEntry *entry = indexLookup(index, value);
+    return entry != NULL ? entry->last->node : NULL;
+}
+
+void indexRemove(struct ValueIndex *index, struct Node *node){
+    struct IndexLink *link = node->link;
+    if (link == NULL) return;
+    node->link = NULL;
+    if (link->prev != NULL && link->next != NULL){
+        link->prev->next = link->next;
+        link->next->prev = link->prev;
+        free(link);
+        return;
+    }
+
+    struct IndexEntry **slot = &index->buckets[indexSlot(index, node->data)];
+    while ((*slot)->value != node->data){
+        slot = &(*slot)->next;
+    }
+    struct IndexEntry *entry = *slot;
+    if (link->prev != NULL) link->prev->next = link->next;
+    else entry->first = link->next;
+    if (link->next != NULL) link->next->prev = link->prev;
+    else entry->last = link->prev;
+    free(link);
+    if (entry->first == NULL){
+        *slot = entry->next;
+        free(entry);
+        index->count--;
+    }
+}
+
+struct Node* indexFind(struct ValueIndex *index, int value){
+    struct IndexEntry *entry = indexLookup(index, value);
+    return entry != NULL ? entry->first->node : NULL;
+}
+
+/* Reversing the list reverses every chain: each link swaps its neighbours, each entry its ends */
+void indexReverse(struct ValueIndex *index, struct Node *head){
+    if (!indexEnabled(index)) return;
+    for (struct Node *node = head; node != NULL; node = node->next) {
+        struct IndexLink *link = node->link;
+        struct IndexLink *prev = link->prev;
+        link->prev = link->next;
+        link->next = prev;
+    }
+    for (int i = 0; i < index->bucketCount; i++) {
+        for (struct IndexEntry *entry = index->buckets[i]; entry != NULL; entry = entry->next) {
+            struct IndexLink *first = entry->first;
+            entry->first = entry->last;
+            entry->last = first;
+        }
+    }
+}
+
+struct List{
+    struct Node *head;
+    struct Node *tail;
+    int length;
+    struct NodeArena arena;
+    struct ValueIndex index;
+};
+
+void initList(struct List *list){
+    list->head = NULL;
+    list->tail = NULL;
+    list->length = 0;
+    list->arena.blocks = NULL;
+    list->arena.used = 0;
+    list->arena.freeList = NULL;
+    list->index.buckets = NULL;
+    list->index.bucketCount = 0;
+    list->index.count = 0;
+}
+
+struct Node* allocNode(struct NodeArena *arena){
+    if (arena->freeList != NULL) {
+        struct Node *node = arena->freeList;
+        arena->freeList = node->next;
+        node->link = NULL;
+        return node;
+    }
+
+    if (arena->blocks == NULL || arena->used == arena->blocks->capacity) {
+        int capacity = FIRST_BLOCK_NODES;
+        if (arena->blocks != NULL && arena->blocks->capacity < MAX_BLOCK_NODES) {
+            capacity = arena->blocks->capacity * 2;
+        } else if (arena->blocks != NULL) {
+            capacity = MAX_BLOCK_NODES;
+        }
+        struct NodeBlock *block = malloc(sizeof(struct NodeBlock) + capacity * sizeof(struct Node));
+        if (block == NULL) {
+            return NULL;
+        }
+        block->capacity = capacity;
+        block->next = arena->blocks;
+        arena->blocks = block;
+        arena->used = 0;
+    }
+    struct Node *node = &arena->blocks->nodes[arena->used++];
+    node->link = NULL;
+    return node;
+}
+
+/* Deleted nodes are kept for reuse; memory goes back only when the list is freed */
+void releaseNode(struct NodeArena *arena, struct Node *node){
+    node->next = arena->freeList;
+    arena->freeList = node;
+}
+
+void discardNode(struct List *list, struct Node *node){
+    indexRemove(&list->index, node);
+    releaseNode(&list->arena, node);
+}
+
+void insertAtBeginning(struct List *list, int value){
+    struct Node* newNode = allocNode(&list->arena);
     if (newNode == NULL) {
         printf("Memory allocation failed!\n");
         return;
     }
     newNode->data = value;
-    newNode->next = *head;
-    *head = newNode;
+    newNode->next = list->head;
+    list->head = newNode;
+    if (list->tail == NULL) {
+        list->tail = newNode;
+    }
+    indexAdd(&list->index, newNode, NULL);
+    list->length++;
     printf("Inserted %d at beginning\n", value);
 }
 
-void insertAtEnd(struct Node **head, int value){
-    struct Node* newNode = malloc(sizeof(struct Node));
+int appendValue(struct List *list, int value){
+    struct Node* newNode = allocNode(&list->arena);
     if (newNode == NULL) {
         printf("Memory allocation failed!\n");
-        return;
+        return 0;
     }
     newNode->data = value;
     newNode->next = NULL;
     
-    if (*head == NULL){
-        *head = newNode;
+    if (list->tail == NULL){
+        list->head = newNode;
     } 
     else{
-        struct Node *temp = *head;
-        while(temp->next != NULL){
-            temp = temp->next;
-        }
-        temp->next = newNode;
+        list->tail->next = newNode;
     }
-    printf("Inserted %d at end\n", value);
+    list->tail = newNode;
+    indexAdd(&list->index, newNode, indexLast(&list->index, value));
+    list->length++;
+    return 1;
 }
 
-void insertAtK(struct Node **head, int value, int k){
+void insertAtEnd(struct List *list, int value){
+    if (appendValue(list, value)) {
+        printf("Inserted %d at end\n", value);
+    }
+}
+
+void insertAtK(struct List *list, int value, int k){
     if (k <= 0) {
         printf("Invalid position! Position should be >= 1\n");
         return;
     }
 
+    if (k > list->length + 1) {
+        printf("Position %d is out of bounds\n", k);
+        return;
+    }
+
     if (k == 1) {
-        insertAtBeginning(head, value);
+        insertAtBeginning(list, value);
         return;
     }
-    
-    struct Node* newNode = malloc(sizeof(struct Node));
+
+    struct Node* newNode = allocNode(&list->arena);
     if (newNode == NULL) {
         printf("Memory allocation failed!\n");
         return;
     }
     newNode->data = value;
     
-    struct Node *temp = *head;
-    for (int i = 1; i < k - 1 && temp != NULL; i++) {
-        temp = temp->next;
-    }
-    
-    if (temp == NULL) {
-        printf("Position %d is out of bounds\n", k);
-        free(newNode);
-        return;
+    /* The walk to position k also passes the nearest earlier node holding value, which is where
+       the new node joins that value's index chain */
+    struct Node *temp = list->tail;
+    struct Node *sameBefore = NULL;
+    if (k <= list->length) {
+        temp = list->head;
+        for (int i = 1; i < k - 1; i++) {
+            if (temp->data == value) {
+                sameBefore = temp;
+            }
+            temp = temp->next;
+        }
+        if (temp->data == value) {
+            sameBefore = temp;
+        }
+    } else {
+        sameBefore = indexLast(&list->index, value);
     }
     
     newNode->next = temp->next;
     temp->next = newNode;
+    if (temp == list->tail) {
+        list->tail = newNode;
+    }
+    indexAdd(&list->index, newNode, sameBefore);
+    list->length++;
     printf("Inserted %d at position %d\n", value, k);
 }
 
-void deleteFromBeginning(struct Node **head){
-    if (*head == NULL) {
+void deleteFromBeginning(struct List *list){
+    if (list->head == NULL) {
         printf("List is empty! Nothing to delete\n");
         return;
     }
     
-    struct Node *temp = *head;
-    *head = (*head)->next;
+    struct Node *temp = list->head;
+    list->head = temp->next;
+    if (list->head == NULL) {
+        list->tail = NULL;
+    }
+    list->length--;
     printf("Deleted %d from beginning\n", temp->data);
-    free(temp);
+    discardNode(list, temp);
+}
+
+/* Unlinks the node after prev; the predecessor walk is the only O(n) part */
+void deleteAfter(struct List *list, struct Node *prev){
+    struct Node *nodeToDelete = prev->next;
+    prev->next = nodeToDelete->next;
+    if (nodeToDelete == list->tail) {
+        list->tail = prev;
+    }
+    list->length--;
+    discardNode(list, nodeToDelete);
 }
 
-void deleteFromEnd(struct Node **head){
-    if (*head == NULL) {
+void deleteFromEnd(struct List *list){
+    if (list->head == NULL) {
         printf("List is empty! Nothing to delete\n");
         return;
     }
     
-    if ((*head)->next == NULL) {
-        printf("Deleted %d from end\n", (*head)->data);
-        free(*head);
-        *head = NULL;
+    if (list->length == 1) {
+        printf("Deleted %d from end\n", list->head->data);
+        discardNode(list, list->head);
+        list->head = NULL;
+        list->tail = NULL;
+        list->length = 0;
         return;
     }
     
-    struct Node *temp = *head;
-    while (temp->next->next != NULL) {
+    struct Node *temp = list->head;
+    for (int i = 1; i < list->length - 1; i++) {
         temp = temp->next;
     }
     
-    printf("Deleted %d from end\n", temp->next->data);
-    free(temp->next);
-    temp->next = NULL;
+    printf("Deleted %d from end\n", list->tail->data);
+    deleteAfter(list, temp);
 }
 
-void deleteFromK(struct Node **head, int k){
-    if (*head == NULL) {
+void deleteFromK(struct List *list, int k){
+    if (list->head == NULL) {
         printf("List is empty! Nothing to delete\n");
         return;
     }
@@ -132,49 +437,103 @@ void deleteFromK(struct Node **head, int k){
         printf("Invalid position! Position should be >= 1\n");
         return;
     }
+
+    if (k > list->length) {
+        printf("Position %d is out of bounds\n", k);
+        return;
+    }
     
     if (k == 1) {
-        deleteFromBeginning(head);
+        deleteFromBeginning(list);
         return;
     }
     
-    struct Node *temp = *head;
-    for (int i = 1; i < k - 1 && temp != NULL; i++) {
+    struct Node *temp = list->head;
+    for (int i = 1; i < k - 1; i++) {
         temp = temp->next;
     }
     
-    if (temp == NULL || temp->next == NULL) {
-        printf("Position %d is out of bounds\n", k);
-        return;
+    printf("Deleted %d from position %d\n", temp->next->data, k);
+    deleteAfter(list, temp);
+}
+
+/* Output for the display functions is built in a 4 KB chunk local to each call: numbers are
+   converted by hand and every full chunk goes out in one write() instead of one printf per node */
+#define OUT_CHUNK 4096
+
+struct Output {
+    char text[OUT_CHUNK];
+    size_t used;
+};
+
+void outFlush(struct Output *out) {
+    size_t done = 0;
+    fflush(stdout);
+    while (done < out->used) {
+        ssize_t n = write(STDOUT_FILENO, out->text + done, out->used - done);
+        if (n <= 0) break;
+        done += n;
     }
-    
-    struct Node *nodeToDelete = temp->next;
-    temp->next = nodeToDelete->next;
-    printf("Deleted %d from position %d\n", nodeToDelete->data, k);
-    free(nodeToDelete);
+    out->used = 0;
 }
 
-void display(struct Node *head){
+void outText(struct Output *out, const char *text) {
+    while (*text != '\0') {
+        if (out->used == OUT_CHUNK) outFlush(out);
+        out->text[out->used++] = *text++;
+    }
+}
+
+void outInt(struct Output *out, int value) {
+    char digits[12];
+    int n = 0;
+    unsigned magnitude = value < 0 ? 0u - (unsigned)value : (unsigned)value;
+    if (out->used + sizeof(digits) > OUT_CHUNK) outFlush(out);
+    do {
+        digits[n++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude != 0);
+    if (value < 0) out->text[out->used++] = '-';
+    while (n > 0) out->text[out->used++] = digits[--n];
+}
+
+void display(struct List *list){
+    struct Node *head = list->head;
     if (head == NULL) {
         printf("List is empty\n");
         return;
     }
     
-    printf("List: ");
+    struct Output out;
+    out.used = 0;
+    outText(&out, "List: ");
     while(head != NULL){
-        printf("%d", head->data);
+        outInt(&out, head->data);
         if (head->next != NULL) {
-            printf(" -> ");
+            outText(&out, " -> ");
         }
         head = head->next;
     }
-    printf("\n");
+    outText(&out, "\n");
+    outFlush(&out);
 }
 
-void search(struct Node *head, int value){
+/* With the index the first node holding value comes straight from its chain: a miss skips the
+   walk and a hit only walks to count the position */
+void search(struct List *list, int value){
+    struct Node *target = NULL;
+    if (indexEnabled(&list->index)) {
+        target = indexFind(&list->index, value);
+        if (target == NULL) {
+            printf("Value %d not found in the list\n", value);
+            return;
+        }
+    }
+
+    struct Node *head = list->head;
     int position = 1;
     while (head != NULL) {
-        if (head->data == value) {
+        if (head == target || (target == NULL && head->data == value)) {
             printf("Value %d found at position %d\n", value, position);
             return;
         }
@@ -184,16 +543,53 @@ void search(struct Node *head, int value){
     printf("Value %d not found in the list\n", value);
 }
 
-void reverse(struct Node **head){
-    if (*head == NULL) {
+void contains(struct List *list, int value){
+    int found = 0;
+    if (indexEnabled(&list->index)) {
+        found = indexFind(&list->index, value) != NULL;
+    } else {
+        struct Node *node = list->head;
+        while (node != NULL && node->data != value) {
+            node = node->next;
+        }
+        found = node != NULL;
+    }
+    printf("Value %d is %sin the list\n", value, found ? "" : "not ");
+}
+
+void toggleIndex(struct List *list){
+    if (indexEnabled(&list->index)) {
+        indexFree(&list->index);
+        printf("Value index disabled\n");
+        return;
+    }
+
+    int bucketCount = 16;
+    while (bucketCount < list->length) {
+        bucketCount *= 2;
+    }
+    if (!indexResize(&list->index, bucketCount)) {
+        return;
+    }
+    for (struct Node *node = list->head; node != NULL && indexEnabled(&list->index); node = node->next) {
+        indexAdd(&list->index, node, indexLast(&list->index, node->data));
+    }
+    if (indexEnabled(&list->index)) {
+        printf("Value index enabled (%d entries)\n", list->index.count);
+    }
+}
+
+void reverse(struct List *list){
+    if (list->head == NULL) {
         printf("List is empty! Nothing to reverse\n");
         return;
     }
     
     struct Node *prev = NULL;
-    struct Node *current = *head;
+    struct Node *current = list->head;
     struct Node *next = NULL;
     
+    list->tail = current;
     while (current != NULL) {
         next = current->next;
         current->next = prev;
@@ -201,10 +597,153 @@ void reverse(struct Node **head){
         current = next;
     }
     
-    *head = prev;
+    list->head = prev;
+    indexReverse(&list->index, list->head);
     printf("List reversed successfully\n");
 }
 
+/* Stable merge of two NULL-terminated sorted chains; *tail receives the last node */
+struct Node* mergeChains(struct Node *a, struct Node *b, struct Node **tail){
+    struct Node dummy;
+    struct Node *last = &dummy;
+    while (a != NULL && b != NULL) {
+        if (a->data <= b->data) {
+            last->next = a;
+            a = a->next;
+        } else {
+            last->next = b;
+            b = b->next;
+        }
+        last = last->next;
+    }
+    last->next = (a != NULL) ? a : b;
+    while (last->next != NULL) {
+        last = last->next;
+    }
+    *tail = last;
+    return dummy.next;
+}
+
+/* Detaches the first n nodes of chain and returns the rest */
+struct Node* cutChain(struct Node *chain, int n){
+    for (int i = 1; i < n && chain != NULL; i++) {
+        chain = chain->next;
+    }
+    if (chain == NULL) {
+        return NULL;
+    }
+    struct Node *rest = chain->next;
+    chain->next = NULL;
+    return rest;
+}
+
+/* Bottom-up merge sort: merges runs of width 1, 2, 4, ... by relinking, O(1) extra space */
+struct Node* sortChain(struct Node *head, int length, struct Node **tail){
+    struct Node dummy;
+    dummy.next = head;
+    *tail = head;
+    for (int width = 1; width < length; width *= 2) {
+        struct Node *prev = &dummy;
+        struct Node *current = dummy.next;
+        while (current != NULL) {
+            struct Node *left = current;
+            struct Node *right = cutChain(left, width);
+            current = cutChain(right, width);
+            prev->next = mergeChains(left, right, tail);
+            prev = *tail;
+        }
+    }
+    return dummy.next;
+}
+
+int isSorted(struct List *list){
+    for (struct Node *node = list->head; node != NULL && node->next != NULL; node = node->next) {
+        if (node->data > node->next->data) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+void sortList(struct List *list){
+    if (list->head == NULL) {
+        printf("List is empty! Nothing to sort\n");
+        return;
+    }
+    list->head = sortChain(list->head, list->length, &list->tail);
+    printf("List sorted successfully\n");
+}
+
+/* Merges sorted other into sorted list in O(n + m); other's nodes and arena blocks move over.
+   The merge is stable and takes list's node first on ties, so other's nodes go to the back of
+   their value chains */
+void mergeLists(struct List *list, struct List *other){
+    if (other->head != NULL) {
+        for (struct Node *node = other->head; node != NULL && indexEnabled(&list->index); node = node->next) {
+            indexAdd(&list->index, node, indexLast(&list->index, node->data));
+        }
+        if (list->head == NULL) {
+            list->head = other->head;
+            list->tail = other->tail;
+        } else {
+            list->head = mergeChains(list->head, other->head, &list->tail);
+        }
+        list->length += other->length;
+    }
+
+    struct NodeBlock **lastBlock = &list->arena.blocks;
+    while (*lastBlock != NULL) {
+        lastBlock = &(*lastBlock)->next;
+    }
+    *lastBlock = other->arena.blocks;
+    if (list->arena.blocks == other->arena.blocks) {
+        list->arena.used = other->arena.used;
+    }
+    struct Node **lastFree = &list->arena.freeList;
+    while (*lastFree != NULL) {
+        lastFree = &(*lastFree)->next;
+    }
+    *lastFree = other->arena.freeList;
+
+    indexFree(&other->index);
+    initList(other);
+}
+
+void mergeSorted(struct List *list){
+    struct List other;
+    int n, value;
+    initList(&other);
+
+    printf("Enter number of elements in the second list: ");
+    scanf("%d", &n);
+    printf("Enter %d elements: ", n);
+    for (int i = 0; i < n; i++) {
+        scanf("%d", &value);
+        appendValue(&other, value);
+    }
+
+    if (!isSorted(list)) {
+        printf("List is not sorted, sorting it first\n");
+        sortList(list);
+    }
+    if (!isSorted(&other)) {
+        other.head = sortChain(other.head, other.length, &other.tail);
+    }
+    mergeLists(list, &other);
+    printf("Merged %d elements, list now has %d\n", n, list->length);
+}
+
+void freeList(struct List *list){
+    indexFree(&list->index);
+    struct NodeBlock *block = list->arena.blocks;
+    while (block != NULL) {
+        struct NodeBlock *temp = block;
+        block = block->next;
+        free(temp);
+    }
+    initList(list);
+}
+
 void displayMenu(){
     printf("\n===== LINKED LIST MENU =====\n");
     printf("1. Insert at beginning\n");
@@ -216,15 +755,20 @@ void displayMenu(){
     printf("7. Display list\n");
     printf("8. Search for value\n");
     printf("9. Reverse list\n");
+    printf("10. Check membership\n");
+    printf("11. Enable/disable value index\n");
+    printf("12. Sort list\n");
+    printf("13. Merge another sorted list\n");
     printf("0. Quit\n");
     printf("============================\n");
     printf("Enter your choice: ");
 }
 
 int main(){
-    struct Node *head = NULL;
+    struct List list;
     int choice, value, position;
     
+    initList(&list);
     while (1) {
         displayMenu();
         scanf("%d", &choice);
@@ -233,13 +777,13 @@ int main(){
             case 1:
                 printf("Enter value to insert at beginning: ");
                 scanf("%d", &value);
-                insertAtBeginning(&head, value);
+                insertAtBeginning(&list, value);
                 break;
                 
             case 2:
                 printf("Enter value to insert at end: ");
                 scanf("%d", &value);
-                insertAtEnd(&head, value);
+                insertAtEnd(&list, value);
                 break;
                 
             case 3:
@@ -247,47 +791,61 @@ int main(){
                 scanf("%d", &value);
                 printf("Enter position (1-indexed): ");
                 scanf("%d", &position);
-                insertAtK(&head, value, position);
+                insertAtK(&list, value, position);
                 break;
                 
             case 4:
-                deleteFromBeginning(&head);
+                deleteFromBeginning(&list);
                 break;
                 
             case 5:
-                deleteFromEnd(&head);
+                deleteFromEnd(&list);
                 break;
                 
             case 6:
                 printf("Enter position to delete (1-indexed): ");
                 scanf("%d", &position);
-                deleteFromK(&head, position);
+                deleteFromK(&list, position);
                 break;
                 
             case 7:
-                display(head);
+                display(&list);
                 break;
                 
             case 8:
                 printf("Enter value to search: ");
                 scanf("%d", &value);
-                search(head, value);
+                search(&list, value);
                 break;
                 
             case 9:
-                reverse(&head);
+                reverse(&list);
+                break;
+                
+            case 10:
+                printf("Enter value to check: ");
+                scanf("%d", &value);
+                contains(&list, value);
+                break;
+                
+            case 11:
+                toggleIndex(&list);
+                break;
+                
+            case 12:
+                sortList(&list);
+                break;
+                
+            case 13:
+                mergeSorted(&list);
                 break;
                 
             case 0:               
-                while (head != NULL) {
-                    struct Node *temp = head;
-                    head = head->next;
-                    free(temp);
-                }
+                freeList(&list);
                 exit(0);
                 
             default:
-                printf("Invalid choice! Please enter a number between 0-9\n");
+                printf("Invalid choice! Please enter a number between 0-13\n");
                 break;
         }
     }
@@ -0,0 +1,429 @@
+/*
+ASSIGNMENT 6 (unrolled linked list variant):
+Same menu as SinglyLinkedList.c, backed by an unrolled linked list.
+Each node holds a small array of values sized to two cache lines. A full node splits in
+half on insert, and a node that drops below half full borrows from or merges with its
+successor on delete, so search and display scan mostly contiguous memory and the
+pointer overhead is shared by a whole node of values. Appending to a full tail starts a
+fresh node instead of splitting, so a list built by appends stays densely packed, and the
+nodes are linked both ways so removing an emptied tail does not rescan from the head.
+*/
+
+#include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
+#include<unistd.h>
+
+#define NODE_BYTES 128
+#define NODE_CAPACITY ((NODE_BYTES - 2 * sizeof(void *) - sizeof(int)) / sizeof(int))
+#define MIN_FILL (NODE_CAPACITY / 2)
+
+/* Requests both cache lines of the next node while the current node's values are scanned; a
+   NULL next is harmless, prefetches never fault */
+#define PREFETCH_NODE(node) (__builtin_prefetch(node), __builtin_prefetch((char *)(node) + NODE_BYTES / 2))
+
+struct Node{
+    struct Node *next;
+    struct Node *prev;
+    int count;
+    int values[NODE_CAPACITY];
+};
+
+struct List{
+    struct Node *head;
+    struct Node *tail;
+    int length;
+};
+
+void initList(struct List *list){
+    list->head = NULL;
+    list->tail = NULL;
+    list->length = 0;
+}
+
+struct Node* createNode(){
+    struct Node *node = malloc(sizeof(struct Node));
+    if (node == NULL) {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+    node->next = NULL;
+    node->prev = NULL;
+    node->count = 0;
+    return node;
+}
+
+void linkAfter(struct List *list, struct Node *node, struct Node *newNode){
+    newNode->prev = node;
+    newNode->next = node->next;
+    if (node->next != NULL) node->next->prev = newNode;
+    else list->tail = newNode;
+    node->next = newNode;
+}
+
+/* Moves the upper half of a full node into a new node linked after it */
+struct Node* splitNode(struct List *list, struct Node *node){
+    struct Node *newNode = createNode();
+    if (newNode == NULL) return NULL;
+    int keep = node->count / 2;
+    newNode->count = node->count - keep;
+    memcpy(newNode->values, node->values + keep, newNode->count * sizeof(int));
+    node->count = keep;
+    linkAfter(list, node, newNode);
+    return newNode;
+}
+
+void unlinkNode(struct List *list, struct Node *node){
+    if (node->prev == NULL) list->head = node->next;
+    else node->prev->next = node->next;
+    if (node->next == NULL) list->tail = node->prev;
+    else node->next->prev = node->prev;
+    free(node);
+}
+
+/* Finds the node holding position k (1-indexed) and the offset inside it */
+struct Node* locate(struct List *list, int k, int *offset){
+    struct Node *node = list->head;
+    while (k > node->count) {
+        k -= node->count;
+        node = node->next;
+    }
+    *offset = k - 1;
+    return node;
+}
+
+int insertPosition(struct List *list, int value, int k){
+    struct Node *node;
+    int offset;
+
+    if (list->head == NULL) {
+        node = createNode();
+        if (node == NULL) return 0;
+        list->head = list->tail = node;
+        offset = 0;
+    } else if (k == list->length + 1) {
+        node = list->tail;
+        offset = node->count;
+        if (node->count == (int)NODE_CAPACITY) {
+            struct Node *newNode = createNode();
+            if (newNode == NULL) return 0;
+            linkAfter(list, node, newNode);
+            node = newNode;
+            offset = 0;
+        }
+    } else {
+        node = locate(list, k, &offset);
+    }
+
+    if (node->count == (int)NODE_CAPACITY) {
+        struct Node *newNode = splitNode(list, node);
+        if (newNode == NULL) return 0;
+        if (offset > node->count) {
+            offset -= node->count;
+            node = newNode;
+        }
+    }
+
+    memmove(node->values + offset + 1, node->values + offset, (node->count - offset) * sizeof(int));
+    node->values[offset] = value;
+    node->count++;
+    list->length++;
+    return 1;
+}
+
+/* Keeps every node but the last at least half full by borrowing from or merging the next node */
+void rebalance(struct List *list, struct Node *node){
+    struct Node *next = node->next;
+    if (node->count == 0 && next == NULL) {
+        unlinkNode(list, node);
+        return;
+    }
+    if (node->count >= (int)MIN_FILL || next == NULL) return;
+
+    if (node->count + next->count <= (int)NODE_CAPACITY) {
+        memcpy(node->values + node->count, next->values, next->count * sizeof(int));
+        node->count += next->count;
+        unlinkNode(list, next);
+    } else {
+        int move = (next->count - node->count) / 2;
+        memcpy(node->values + node->count, next->values, move * sizeof(int));
+        node->count += move;
+        next->count -= move;
+        memmove(next->values, next->values + move, next->count * sizeof(int));
+    }
+}
+
+int deletePosition(struct List *list, int k){
+    int offset;
+    struct Node *node = locate(list, k, &offset);
+    int value = node->values[offset];
+
+    node->count--;
+    memmove(node->values + offset, node->values + offset + 1, (node->count - offset) * sizeof(int));
+    list->length--;
+    rebalance(list, node);
+    return value;
+}
+
+void insertAtBeginning(struct List *list, int value){
+    if (insertPosition(list, value, 1)) printf("Inserted %d at beginning\n", value);
+}
+
+void insertAtEnd(struct List *list, int value){
+    if (insertPosition(list, value, list->length + 1)) printf("Inserted %d at end\n", value);
+}
+
+void insertAtK(struct List *list, int value, int k){
+    if (k <= 0) {
+        printf("Invalid position! Position should be >= 1\n");
+        return;
+    }
+    if (k > list->length + 1) {
+        printf("Position %d is out of bounds\n", k);
+        return;
+    }
+    if (k == 1) {
+        insertAtBeginning(list, value);
+        return;
+    }
+    if (insertPosition(list, value, k)) printf("Inserted %d at position %d\n", value, k);
+}
+
+void deleteFromBeginning(struct List *list){
+    if (list->length == 0) {
+        printf("List is empty! Nothing to delete\n");
+        return;
+    }
+    printf("Deleted %d from beginning\n", deletePosition(list, 1));
+}
+
+void deleteFromEnd(struct List *list){
+    if (list->length == 0) {
+        printf("List is empty! Nothing to delete\n");
+        return;
+    }
+    struct Node *tail = list->tail;
+    int value = tail->values[--tail->count];
+    list->length--;
+    if (tail->count == 0) unlinkNode(list, tail);
+    printf("Deleted %d from end\n", value);
+}
+
+void deleteFromK(struct List *list, int k){
+    if (list->length == 0) {
+        printf("List is empty! Nothing to delete\n");
+        return;
+    }
+    if (k <= 0) {
+        printf("Invalid position! Position should be >= 1\n");
+        return;
+    }
+    if (k > list->length) {
+        printf("Position %d is out of bounds\n", k);
+        return;
+    }
+    if (k == 1) {
+        deleteFromBeginning(list);
+        return;
+    }
+    printf("Deleted %d from position %d\n", deletePosition(list, k), k);
+}
+
+/* Output for the display functions is built in a 4 KB chunk local to each call: numbers are
+   converted by hand and every full chunk goes out in one write() instead of one printf per node */
+#define OUT_CHUNK 4096
+
+struct Output {
+    char text[OUT_CHUNK];
+    size_t used;
+};
+
+void outFlush(struct Output *out) {
+    size_t done = 0;
+    fflush(stdout);
+    while (done < out->used) {
+        ssize_t n = write(STDOUT_FILENO, out->text + done, out->used - done);
+        if (n <= 0) break;
+        done += n;
+    }
+    out->used = 0;
+}
+
+void outText(struct Output *out, const char *text) {
+    while (*text != '\0') {
+        if (out->used == OUT_CHUNK) outFlush(out);
+        out->text[out->used++] = *text++;
+    }
+}
+
+void outInt(struct Output *out, int value) {
+    char digits[12];
+    int n = 0;
+    unsigned magnitude = value < 0 ? 0u - (unsigned)value : (unsigned)value;
+    if (out->used + sizeof(digits) > OUT_CHUNK) outFlush(out);
+    do {
+        digits[n++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude != 0);
+    if (value < 0) out->text[out->used++] = '-';
+    while (n > 0) out->text[out->used++] = digits[--n];
+}
+
+void display(struct List *list){
+    if (list->length == 0) {
+        printf("List is empty\n");
+        return;
+    }
+
+    struct Output out;
+    out.used = 0;
+    outText(&out, "List: ");
+    for (struct Node *node = list->head; node != NULL; node = node->next) {
+        PREFETCH_NODE(node->next);
+        for (int i = 0; i < node->count; i++) {
+            outInt(&out, node->values[i]);
+            if (i + 1 < node->count || node->next != NULL) outText(&out, " -> ");
+        }
+    }
+    outText(&out, "\n");
+    outFlush(&out);
+}
+
+void search(struct List *list, int value){
+    int position = 1;
+    for (struct Node *node = list->head; node != NULL; node = node->next) {
+        PREFETCH_NODE(node->next);
+        for (int i = 0; i < node->count; i++) {
+            if (node->values[i] == value) {
+                printf("Value %d found at position %d\n", value, position + i);
+                return;
+            }
+        }
+        position += node->count;
+    }
+    printf("Value %d not found in the list\n", value);
+}
+
+void reverse(struct List *list){
+    if (list->length == 0) {
+        printf("List is empty! Nothing to reverse\n");
+        return;
+    }
+
+    struct Node *prev = NULL;
+    struct Node *current = list->head;
+    struct Node *next = NULL;
+
+    list->tail = current;
+    while (current != NULL) {
+        for (int i = 0, j = current->count - 1; i < j; i++, j--) {
+            int temp = current->values[i];
+            current->values[i] = current->values[j];
+            current->values[j] = temp;
+        }
+        next = current->next;
+        current->next = prev;
+        current->prev = next;
+        prev = current;
+        current = next;
+    }
+
+    list->head = prev;
+    printf("List reversed successfully\n");
+}
+
+void freeList(struct List *list){
+    while (list->head != NULL) {
+        struct Node *temp = list->head;
+        list->head = list->head->next;
+        free(temp);
+    }
+    initList(list);
+}
+
+void displayMenu(){
+    printf("\n===== UNROLLED LINKED LIST MENU =====\n");
+    printf("1. Insert at beginning\n");
+    printf("2. Insert at end\n");
+    printf("3. Insert at position k\n");
+    printf("4. Delete from beginning\n");
+    printf("5. Delete from end\n");
+    printf("6. Delete from position k\n");
+    printf("7. Display list\n");
+    printf("8. Search for value\n");
+    printf("9. Reverse list\n");
+    printf("0. Quit\n");
+    printf("=====================================\n");
+    printf("Enter your choice: ");
+}
+
+int main(){
+    struct List list;
+    int choice, value, position;
+
+    initList(&list);
+    while (1) {
+        displayMenu();
+        scanf("%d", &choice);
+
+        switch (choice) {
+            case 1:
+                printf("Enter value to insert at beginning: ");
+                scanf("%d", &value);
+                insertAtBeginning(&list, value);
+                break;
+
+            case 2:
+                printf("Enter value to insert at end: ");
+                scanf("%d", &value);
+                insertAtEnd(&list, value);
+                break;
+
+            case 3:
+                printf("Enter value to insert: ");
+                scanf("%d", &value);
+                printf("Enter position (1-indexed): ");
+                scanf("%d", &position);
+                insertAtK(&list, value, position);
+                break;
+
+            case 4:
+                deleteFromBeginning(&list);
+                break;
+
+            case 5:
+                deleteFromEnd(&list);
+                break;
+
+            case 6:
+                printf("Enter position to delete (1-indexed): ");
+                scanf("%d", &position);
+                deleteFromK(&list, position);
+                break;
+
+            case 7:
+                display(&list);
+                break;
+
+            case 8:
+                printf("Enter value to search: ");
+                scanf("%d", &value);
+                search(&list, value);
+                break;
+
+            case 9:
+                reverse(&list);
+                break;
+
+            case 0:
+                freeList(&list);
+                exit(0);
+
+            default:
+                printf("Invalid choice! Please enter a number between 0-9\n");
+                break;
+        }
+    }
+
+    return 0;
+}
@@ -9,93 +9,375 @@ Problem Statement: Write a menu driven program in C to perform the following ope
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <unistd.h>
 
 struct Node {
     int data;
     struct Node *next;
+    struct IndexLink *link;
 };
 
-void insertAtK(struct Node **head, int value, int k) {
-    struct Node *newNode = malloc(sizeof(struct Node));
-    if (!newNode) { printf("Memory allocation failed!\n"); return; }
-    newNode->data = value;
+/* Optional value index shared by both rings: a hash multimap from value to the nodes holding it.
+   Each distinct value keeps a chain of links and every node points at its own link, so adding or
+   removing a node is O(1). A link also names the ring its node was in through a ring tag; tags
+   form a union-find forest, so a splice re-homes a whole ring by hanging one tag under another
+   instead of visiting its nodes */
+struct RingTag {
+    struct RingTag *parent;
+    struct RingTag *next;
+};
 
-    if (*head == NULL) {
-        newNode->next = newNode;
-        *head = newNode;
-        printf("Inserted %d at position 1\n", value);
-        return;
+struct IndexLink {
+    struct Node *node;
+    struct RingTag *ring;
+    struct IndexLink *prev;
+    struct IndexLink *next;
+};
+
+struct IndexEntry {
+    int value;
+    struct IndexLink *first;
+    struct IndexEntry *next;
+};
+
+struct ValueIndex {
+    struct IndexEntry **buckets;
+    int bucketCount;
+    int count;
+    struct RingTag *rings[2];
+    struct RingTag *tags;
+};
+
+int indexEnabled(struct ValueIndex *index) {
+    return index->buckets != NULL;
+}
+
+unsigned indexSlot(struct ValueIndex *index, int value) {
+    unsigned h = (unsigned)value * 2654435761u;
+    return (h ^ (h >> 16)) & (index->bucketCount - 1);
+}
+
+int indexResize(struct ValueIndex *index, int bucketCount) {
+    struct IndexEntry **buckets = calloc(bucketCount, sizeof(struct IndexEntry *));
+    if (buckets == NULL) {
+        printf("Memory allocation failed!\n");
+        return 0;
     }
+    struct IndexEntry **old = index->buckets;
+    int oldCount = index->bucketCount;
+    index->buckets = buckets;
+    index->bucketCount = bucketCount;
+    for (int i = 0; i < oldCount; i++) {
+        while (old[i] != NULL) {
+            struct IndexEntry *entry = old[i];
+            old[i] = entry->next;
+            unsigned slot = indexSlot(index, entry->value);
+            entry->next = buckets[slot];
+            buckets[slot] = entry;
+        }
+    }
+    free(old);
+    return 1;
+}
 
-    if (k <= 1) {
-        struct Node *last = *head;
-        while (last->next != *head)
-            last = last->next;
-        newNode->next = *head;
-        last->next = newNode;
-        *head = newNode;
-        printf("Inserted %d at position 1\n", value);
-        return;
+struct IndexEntry* indexLookup(struct ValueIndex *index, int value) {
+    struct IndexEntry *entry = index->buckets[indexSlot(index, value)];
+    while (entry != NULL && entry->value != value) {
+        entry = entry->next;
     }
+    return entry;
+}
 
-    struct Node *temp = *head;
-    for (int i = 1; i < k - 1 && temp->next != *head; i++)
-        temp = temp->next;
+void indexFree(struct ValueIndex *index) {
+    for (int i = 0; i < index->bucketCount; i++) {
+        while (index->buckets[i] != NULL) {
+            struct IndexEntry *entry = index->buckets[i];
+            index->buckets[i] = entry->next;
+            while (entry->first != NULL) {
+                struct IndexLink *link = entry->first;
+                entry->first = link->next;
+                link->node->link = NULL;
+                free(link);
+            }
+            free(entry);
+        }
+    }
+    while (index->tags != NULL) {
+        struct RingTag *tag = index->tags;
+        index->tags = tag->next;
+        free(tag);
+    }
+    free(index->buckets);
+    index->buckets = NULL;
+    index->bucketCount = 0;
+    index->count = 0;
+    index->rings[0] = index->rings[1] = NULL;
+}
 
-    newNode->next = temp->next;
-    temp->next = newNode;
-    printf("Inserted %d at position %d\n", value, k);
+/* An index missing a node would give wrong answers, so running out of memory turns it off */
+void indexFail(struct ValueIndex *index) {
+    indexFree(index);
+    printf("Memory allocation failed! Value index disabled\n");
 }
 
-void deleteFromK(struct Node **head, int k) {
-    if (*head == NULL) { printf("List is empty!\n"); return; }
+/* Root of a tag's tree, halving the path on the way up */
+struct RingTag* ringRoot(struct RingTag *tag) {
+    while (tag->parent != tag) {
+        tag->parent = tag->parent->parent;
+        tag = tag->parent;
+    }
+    return tag;
+}
 
-    struct Node *temp = *head;
+/* The root tag of ring id, created the first time a node of that ring is indexed */
+struct RingTag* indexRing(struct ValueIndex *index, int id) {
+    if (index->rings[id] == NULL) {
+        struct RingTag *tag = malloc(sizeof(struct RingTag));
+        if (tag == NULL) return NULL;
+        tag->parent = tag;
+        tag->next = index->tags;
+        index->tags = tag;
+        index->rings[id] = tag;
+    }
+    return index->rings[id];
+}
 
-    if (k <= 1) {
-        if (temp->next == temp) {
-            printf("Deleted %d\n", temp->data);
-            free(temp);
-            *head = NULL;
+void indexAdd(struct ValueIndex *index, struct Node *node, int id) {
+    if (!indexEnabled(index)) return;
+    struct RingTag *ring = indexRing(index, id);
+    if (ring == NULL) {
+        indexFail(index);
+        return;
+    }
+    struct IndexEntry *entry = indexLookup(index, node->data);
+    if (entry == NULL) {
+        if (index->count >= index->bucketCount && !indexResize(index, index->bucketCount * 2)) {
+            indexFail(index);
             return;
         }
+        entry = malloc(sizeof(struct IndexEntry));
+        if (entry == NULL) {
+            indexFail(index);
+            return;
+        }
+        unsigned slot = indexSlot(index, node->data);
+        entry->value = node->data;
+        entry->first = NULL;
+        entry->next = index->buckets[slot];
+        index->buckets[slot] = entry;
+        index->count++;
+    }
+    struct IndexLink *link = malloc(sizeof(struct IndexLink));
+    if (link == NULL) {
+        indexFail(index);
+        return;
+    }
+    link->node = node;
+    link->ring = ring;
+    link->prev = NULL;
+    link->next = entry->first;
+    if (entry->first != NULL) entry->first->prev = link;
+    entry->first = link;
+    node->link = link;
+}
 
-        struct Node *last = *head;
-        while (last->next != *head)
-            last = last->next;
-
-        last->next = temp->next;
-        *head = temp->next;
-        printf("Deleted %d from position 1\n", temp->data);
-        free(temp);
+void indexRemove(struct ValueIndex *index, struct Node *node) {
+    struct IndexLink *link = node->link;
+    if (link == NULL) return;
+    node->link = NULL;
+    if (link->next != NULL) link->next->prev = link->prev;
+    if (link->prev != NULL) {
+        link->prev->next = link->next;
+        free(link);
         return;
     }
 
-    for (int i = 1; i < k - 1 && temp->next != *head; i++)
+    struct IndexEntry **slot = &index->buckets[indexSlot(index, node->data)];
+    while ((*slot)->value != node->data) {
+        slot = &(*slot)->next;
+    }
+    struct IndexEntry *entry = *slot;
+    entry->first = link->next;
+    free(link);
+    if (entry->first == NULL) {
+        *slot = entry->next;
+        free(entry);
+        index->count--;
+    }
+}
+
+/* Walks value's chain for a node whose tag leads to ring id's root */
+int indexContains(struct ValueIndex *index, int id, int value) {
+    struct IndexEntry *entry = indexLookup(index, value);
+    if (entry == NULL || index->rings[id] == NULL) return 0;
+    for (struct IndexLink *link = entry->first; link != NULL; link = link->next) {
+        if (ringRoot(link->ring) == index->rings[id]) return 1;
+    }
+    return 0;
+}
+
+/* Every node of ring src now belongs to ring dst: one tag changes parent */
+void indexJoin(struct ValueIndex *index, int dst, int src) {
+    struct RingTag *moved = index->rings[src];
+    index->rings[src] = NULL;
+    if (moved == NULL) return;
+    if (index->rings[dst] == NULL) index->rings[dst] = moved;
+    else moved->parent = index->rings[dst];
+}
+
+/* Ring stay keeps only its first count nodes, starting at first; the rest join ring to. The
+   kept nodes get a fresh tag, so the cost is the walk to the split point the caller made anyway */
+void indexSplit(struct ValueIndex *index, int stay, int to, struct Node *first, int count) {
+    if (!indexEnabled(index)) return;
+    struct RingTag *old = index->rings[stay];
+    index->rings[stay] = NULL;
+    if (count > 0) {
+        struct RingTag *ring = indexRing(index, stay);
+        if (ring == NULL) {
+            indexFail(index);
+            return;
+        }
+        for (int i = 0; i < count; i++, first = first->next)
+            first->link->ring = ring;
+    }
+    if (old == NULL) return;
+    if (index->rings[to] == NULL) index->rings[to] = old;
+    else old->parent = index->rings[to];
+}
+
+/* Anchored on the tail: the head is always tail->next, so both ends are one hop away. Both rings
+   point at the same index and id tells them apart in it */
+struct List {
+    struct Node *tail;
+    int size;
+    struct ValueIndex *index;
+    int id;
+};
+
+void initList(struct List *list, struct ValueIndex *index, int id) {
+    list->tail = NULL;
+    list->size = 0;
+    list->index = index;
+    list->id = id;
+}
+
+struct Node* headOf(struct List *list) {
+    return list->tail ? list->tail->next : NULL;
+}
+
+/* Node at position k - 1, where position 0 is the tail */
+struct Node* predecessor(struct List *list, int k) {
+    struct Node *temp = list->tail;
+    for (int i = 1; i < k; i++)
         temp = temp->next;
+    return temp;
+}
+
+void insertAtK(struct List *list, int value, int k) {
+    if (k < 1 || k > list->size + 1) { printf("Position %d out of bounds\n", k); return; }
+
+    struct Node *newNode = malloc(sizeof(struct Node));
+    if (!newNode) { printf("Memory allocation failed!\n"); return; }
+    newNode->data = value;
+    newNode->link = NULL;
+    indexAdd(list->index, newNode, list->id);
 
-    if (temp->next == *head) { printf("Position %d out of bounds\n", k); return; }
+    if (list->tail == NULL) {
+        newNode->next = newNode;
+        list->tail = newNode;
+    } else {
+        struct Node *temp = k == list->size + 1 ? list->tail : predecessor(list, k);
+        newNode->next = temp->next;
+        temp->next = newNode;
+        if (temp == list->tail && k != 1) list->tail = newNode;
+    }
+    list->size++;
+    printf("Inserted %d at position %d\n", value, k);
+}
 
+void deleteFromK(struct List *list, int k) {
+    if (list->tail == NULL) { printf("List is empty!\n"); return; }
+    if (k < 1 || k > list->size) { printf("Position %d out of bounds\n", k); return; }
+
+    struct Node *temp = predecessor(list, k);
     struct Node *del = temp->next;
-    temp->next = del->next;
+
+    if (del == temp) {
+        list->tail = NULL;
+    } else {
+        temp->next = del->next;
+        if (del == list->tail) list->tail = temp;
+    }
+    list->size--;
     printf("Deleted %d from position %d\n", del->data, k);
+    indexRemove(list->index, del);
     free(del);
 }
 
-void display(struct Node *head) {
+/* Output for the display functions is built in a 4 KB chunk local to each call: numbers are
+   converted by hand and every full chunk goes out in one write() instead of one printf per node */
+#define OUT_CHUNK 4096
+
+struct Output {
+    char text[OUT_CHUNK];
+    size_t used;
+};
+
+void outFlush(struct Output *out) {
+    size_t done = 0;
+    fflush(stdout);
+    while (done < out->used) {
+        ssize_t n = write(STDOUT_FILENO, out->text + done, out->used - done);
+        if (n <= 0) break;
+        done += n;
+    }
+    out->used = 0;
+}
+
+void outText(struct Output *out, const char *text) {
+    while (*text != '\0') {
+        if (out->used == OUT_CHUNK) outFlush(out);
+        out->text[out->used++] = *text++;
+    }
+}
+
+void outInt(struct Output *out, int value) {
+    char digits[12];
+    int n = 0;
+    unsigned magnitude = value < 0 ? 0u - (unsigned)value : (unsigned)value;
+    if (out->used + sizeof(digits) > OUT_CHUNK) outFlush(out);
+    do {
+        digits[n++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude != 0);
+    if (value < 0) out->text[out->used++] = '-';
+    while (n > 0) out->text[out->used++] = digits[--n];
+}
+
+void display(struct List *list) {
+    struct Node *head = headOf(list);
     if (!head) { printf("List is empty\n"); return; }
     struct Node *temp = head;
-    printf("List: ");
+    struct Output out;
+    out.used = 0;
+    outText(&out, "List: ");
     do {
-        printf("%d", temp->data);
+        outInt(&out, temp->data);
         temp = temp->next;
-        if (temp != head) printf(" -> ");
+        if (temp != head) outText(&out, " -> ");
     } while (temp != head);
-    printf(" (circular)\n");
+    outText(&out, " (circular)\n");
+    outFlush(&out);
 }
 
-void search(struct Node *head, int value) {
+/* Positions still need a walk around the ring; the index only short-circuits misses */
+void search(struct List *list, int value) {
+    struct Node *head = headOf(list);
     if (!head) { printf("List is empty\n"); return; }
+    if (indexEnabled(list->index) && !indexContains(list->index, list->id, value)) {
+        printf("%d not found\n", value);
+        return;
+    }
     struct Node *temp = head;
     int pos = 1;
     do {
@@ -109,28 +391,258 @@ void search(struct Node *head, int value) {
     printf("%d not found\n", value);
 }
 
+void contains(struct List *list, int value) {
+    int found = 0;
+    if (indexEnabled(list->index)) {
+        found = indexContains(list->index, list->id, value);
+    } else if (list->tail) {
+        struct Node *temp = list->tail;
+        do {
+            if (temp->data == value) { found = 1; break; }
+            temp = temp->next;
+        } while (temp != list->tail);
+    }
+    printf("%d is %sin the list\n", value, found ? "" : "not ");
+}
+
+/* The index covers both rings, so it is switched on or off for both together */
+void toggleIndex(struct List *list, struct List *other) {
+    struct ValueIndex *index = list->index;
+    if (indexEnabled(index)) {
+        indexFree(index);
+        printf("Value index disabled\n");
+        return;
+    }
+    int bucketCount = 16;
+    while (bucketCount < list->size + other->size)
+        bucketCount *= 2;
+    if (!indexResize(index, bucketCount)) return;
+    for (int i = 0; i < list->size && indexEnabled(index); i++) {
+        list->tail = list->tail->next;
+        indexAdd(index, list->tail, list->id);
+    }
+    for (int i = 0; i < other->size && indexEnabled(index); i++) {
+        other->tail = other->tail->next;
+        indexAdd(index, other->tail, other->id);
+    }
+    if (indexEnabled(index)) printf("Value index enabled (%d entries)\n", index->count);
+}
+
+void freeList(struct List *list) {
+    indexFree(list->index);
+    while (list->size > 0) {
+        struct Node *head = list->tail->next;
+        list->tail->next = head->next;
+        free(head);
+        list->size--;
+    }
+    list->tail = NULL;
+}
+
+/* Moves the head forward by k; a singly linked ring only advances, so this costs k mod size hops */
+void rotate(struct List *list, int k) {
+    if (!list->tail) { printf("List is empty!\n"); return; }
+    int steps = k % list->size;
+    if (steps < 0) steps += list->size;
+    for (int i = 0; i < steps; i++)
+        list->tail = list->tail->next;
+    printf("Rotated by %d, head is now %d\n", k, list->tail->next->data);
+}
+
+/* Splices the nodes of src after the tail of dst in O(1) and leaves src empty */
+void linkRings(struct List *dst, struct List *src) {
+    if (!src->tail) return;
+    if (dst->tail) {
+        struct Node *dstHead = dst->tail->next;
+        dst->tail->next = src->tail->next;
+        src->tail->next = dstHead;
+    }
+    dst->tail = src->tail;
+    dst->size += src->size;
+    src->tail = NULL;
+    src->size = 0;
+}
+
+/* Appends all of src to dst in O(1), index included */
+void concatenate(struct List *dst, struct List *src) {
+    indexJoin(dst->index, dst->id, src->id);
+    linkRings(dst, src);
+}
+
+/* Cuts positions k..size into their own ring and appends it to other */
+void split(struct List *list, int k, struct List *other) {
+    if (!list->tail) { printf("List is empty!\n"); return; }
+    if (k < 1 || k > list->size) { printf("Position %d out of bounds\n", k); return; }
+
+    struct Node *last = predecessor(list, k);
+    indexSplit(list->index, list->id, other->id, headOf(list), k - 1);
+    struct List part;
+    initList(&part, list->index, list->id);
+    part.tail = list->tail;
+    part.size = list->size - k + 1;
+    if (k == 1) {
+        list->tail = NULL;
+    } else {
+        struct Node *head = list->tail->next;
+        list->tail->next = last->next;
+        last->next = head;
+        list->tail = last;
+    }
+    list->size = k - 1;
+    int moved = part.size;
+    linkRings(other, &part);
+    printf("Moved %d nodes to the other ring\n", moved);
+}
+
+/* Stable merge of two NULL-terminated sorted chains; *tail receives the last node */
+struct Node* mergeChains(struct Node *a, struct Node *b, struct Node **tail) {
+    struct Node dummy, *last = &dummy;
+    while (a && b) {
+        if (a->data <= b->data) { last->next = a; a = a->next; }
+        else { last->next = b; b = b->next; }
+        last = last->next;
+    }
+    last->next = a ? a : b;
+    while (last->next) last = last->next;
+    *tail = last;
+    return dummy.next;
+}
+
+/* Detaches the first n nodes of chain and returns the rest */
+struct Node* cutChain(struct Node *chain, int n) {
+    for (int i = 1; i < n && chain; i++) chain = chain->next;
+    if (!chain) return NULL;
+    struct Node *rest = chain->next;
+    chain->next = NULL;
+    return rest;
+}
+
+/* Bottom-up merge sort: the ring is opened at the tail, sorted as a chain and closed again */
+void sortRing(struct List *list) {
+    if (!list->tail) return;
+    struct Node dummy, *tail = list->tail;
+    dummy.next = headOf(list);
+    list->tail->next = NULL;
+    for (int width = 1; width < list->size; width *= 2) {
+        struct Node *prev = &dummy, *cur = dummy.next;
+        while (cur) {
+            struct Node *left = cur;
+            struct Node *right = cutChain(left, width);
+            cur = cutChain(right, width);
+            prev->next = mergeChains(left, right, &tail);
+            prev = tail;
+        }
+    }
+    tail->next = dummy.next;
+    list->tail = tail;
+}
+
+int isSorted(struct List *list) {
+    if (!list->tail) return 1;
+    for (struct Node *cur = headOf(list); cur != list->tail; cur = cur->next)
+        if (cur->data > cur->next->data) return 0;
+    return 1;
+}
+
+void sortList(struct List *list) {
+    if (!list->tail) { printf("List is empty!\n"); return; }
+    sortRing(list);
+    printf("List sorted\n");
+}
+
+/* Merges the other ring into this one in O(n + m); both are sorted first if needed */
+void mergeRings(struct List *list, struct List *other) {
+    if (!other->tail) { printf("Other ring is empty\n"); return; }
+    if (!isSorted(list)) { printf("Sorting this ring first\n"); sortRing(list); }
+    if (!isSorted(other)) { printf("Sorting the other ring first\n"); sortRing(other); }
+
+    int moved = other->size;
+    struct Node *b = headOf(other), *tail;
+    indexJoin(list->index, list->id, other->id);
+    other->tail->next = NULL;
+    other->tail = NULL;
+    other->size = 0;
+    if (list->tail) {
+        struct Node *a = headOf(list);
+        list->tail->next = NULL;
+        b = mergeChains(a, b, &tail);
+    } else {
+        for (tail = b; tail->next; tail = tail->next);
+    }
+    tail->next = b;
+    list->tail = tail;
+    list->size += moved;
+    printf("Merged %d nodes, ring now has %d\n", moved, list->size);
+}
+
+/* Removes every m-th node until one is left, continuing from the last deletion each time */
+void josephus(struct List *list, int m) {
+    if (!list->tail) { printf("List is empty!\n"); return; }
+    if (m < 1) { printf("Step must be >= 1\n"); return; }
+
+    struct Node *prev = list->tail;
+    printf("Eliminated:");
+    while (list->size > 1) {
+        int steps = (m - 1) % list->size;
+        for (int i = 0; i < steps; i++)
+            prev = prev->next;
+        struct Node *del = prev->next;
+        prev->next = del->next;
+        if (del == list->tail) list->tail = prev;
+        list->size--;
+        printf(" %d", del->data);
+        indexRemove(list->index, del);
+        free(del);
+    }
+    printf("\nSurvivor: %d\n", list->tail->data);
+}
+
 void displayMenu() {
     printf("\n===== CIRCULAR LINKED LIST MENU =====\n");
     printf("1. Insert at position k\n");
     printf("2. Delete from position k\n");
     printf("3. Display list\n");
     printf("4. Search value\n");
+    printf("5. Check membership\n");
+    printf("6. Enable/disable value index\n");
+    printf("7. Rotate by k\n");
+    printf("8. Split at position k (tail part moves to the other ring)\n");
+    printf("9. Concatenate the other ring onto this one\n");
+    printf("10. Switch active ring\n");
+    printf("11. Josephus elimination\n");
+    printf("12. Sort list\n");
+    printf("13. Merge the other ring into this one (sorted)\n");
     printf("0. Exit\n");
     printf("Enter your choice: ");
 }
 
 int main() {
-    struct Node *head = NULL;
+    struct ValueIndex index = {NULL, 0, 0, {NULL, NULL}, NULL};
+    struct List rings[2];
+    int active = 0;
     int ch, val, k;
+    initList(&rings[0], &index, 0);
+    initList(&rings[1], &index, 1);
     while (1) {
+        struct List *list = &rings[active], *other = &rings[1 - active];
+        printf("\n[Ring %d active, other ring has %d nodes]", active + 1, other->size);
         displayMenu();
         scanf("%d", &ch);
         switch (ch) {
-            case 1: printf("Enter value and position: "); scanf("%d%d", &val, &k); insertAtK(&head, val, k); break;
-            case 2: printf("Enter position to delete: "); scanf("%d", &k); deleteFromK(&head, k); break;
-            case 3: display(head); break;
-            case 4: printf("Enter value to search: "); scanf("%d", &val); search(head, val); break;
-            case 0: exit(0);
+            case 1: printf("Enter value and position: "); scanf("%d%d", &val, &k); insertAtK(list, val, k); break;
+            case 2: printf("Enter position to delete: "); scanf("%d", &k); deleteFromK(list, k); break;
+            case 3: display(list); break;
+            case 4: printf("Enter value to search: "); scanf("%d", &val); search(list, val); break;
+            case 5: printf("Enter value to check: "); scanf("%d", &val); contains(list, val); break;
+            case 6: toggleIndex(list, other); break;
+            case 7: printf("Enter k: "); scanf("%d", &k); rotate(list, k); break;
+            case 8: printf("Enter position to split at: "); scanf("%d", &k); split(list, k, other); break;
+            case 9: printf("Appended %d nodes\n", other->size); concatenate(list, other); break;
+            case 10: active = 1 - active; printf("Ring %d is now active\n", active + 1); break;
+            case 11: printf("Enter step m: "); scanf("%d", &k); josephus(list, k); break;
+            case 12: sortList(list); break;
+            case 13: mergeRings(list, other); break;
+            case 0: freeList(list); freeList(other); exit(0);
             default: printf("Invalid choice\n");
         }
     }
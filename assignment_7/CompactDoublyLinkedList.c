@@ -0,0 +1,267 @@
+/*
+ASSIGNMENT 7 (compact variant):
+Doubly linked list stored in one growable array of nodes with 32-bit prev/next indices.
+A node takes 12 bytes instead of 24 plus malloc overhead, deleted slots are chained into
+a free list and reused, and compaction renumbers nodes in traversal order so that walking
+the list becomes a sequential scan of the array again.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#define NIL UINT32_MAX
+#define INITIAL_CAPACITY 16
+#define PREFETCH_AHEAD 32
+
+struct Node {
+    int data;
+    uint32_t prev;
+    uint32_t next;
+};
+
+struct List {
+    struct Node *nodes;
+    uint32_t capacity;
+    uint32_t used;
+    uint32_t freeHead;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t size;
+};
+
+void initList(struct List *list) {
+    list->nodes = NULL;
+    list->capacity = list->used = list->size = 0;
+    list->freeHead = list->head = list->tail = NIL;
+}
+
+/* After compact(), or when the list was built by appends, the walk visits slots in array order,
+   so the slot PREFETCH_AHEAD places further on is the node needed a few steps from now */
+void prefetchAhead(struct List *list, uint32_t slot) {
+    if (slot + PREFETCH_AHEAD < list->used) __builtin_prefetch(&list->nodes[slot + PREFETCH_AHEAD]);
+}
+
+/* Returns a slot index, reusing deleted slots before growing the array */
+uint32_t allocSlot(struct List *list) {
+    if (list->freeHead != NIL) {
+        uint32_t slot = list->freeHead;
+        list->freeHead = list->nodes[slot].next;
+        return slot;
+    }
+    if (list->used == list->capacity) {
+        uint32_t capacity = list->capacity ? list->capacity * 2 : INITIAL_CAPACITY;
+        if (capacity <= list->capacity) return NIL;
+        struct Node *nodes = realloc(list->nodes, (size_t)capacity * sizeof(struct Node));
+        if (!nodes) return NIL;
+        list->nodes = nodes;
+        list->capacity = capacity;
+    }
+    return list->used++;
+}
+
+void freeSlot(struct List *list, uint32_t slot) {
+    list->nodes[slot].next = list->freeHead;
+    list->freeHead = slot;
+}
+
+/* Walks from whichever end is closer to position k */
+uint32_t slotAt(struct List *list, uint32_t k) {
+    uint32_t slot;
+    if (k <= (list->size + 1) / 2) {
+        slot = list->head;
+        for (uint32_t i = 1; i < k; i++)
+            slot = list->nodes[slot].next;
+    } else {
+        slot = list->tail;
+        for (uint32_t i = list->size; i > k; i--)
+            slot = list->nodes[slot].prev;
+    }
+    return slot;
+}
+
+/* Links slot in front of next, or at the tail when next is NIL */
+void linkBefore(struct List *list, uint32_t next, uint32_t slot) {
+    struct Node *nodes = list->nodes;
+    uint32_t prev = next != NIL ? nodes[next].prev : list->tail;
+    nodes[slot].prev = prev;
+    nodes[slot].next = next;
+    if (prev != NIL) nodes[prev].next = slot;
+    else list->head = slot;
+    if (next != NIL) nodes[next].prev = slot;
+    else list->tail = slot;
+    list->size++;
+}
+
+int unlinkSlot(struct List *list, uint32_t slot) {
+    struct Node *nodes = list->nodes;
+    int value = nodes[slot].data;
+    if (nodes[slot].prev != NIL) nodes[nodes[slot].prev].next = nodes[slot].next;
+    else list->head = nodes[slot].next;
+    if (nodes[slot].next != NIL) nodes[nodes[slot].next].prev = nodes[slot].prev;
+    else list->tail = nodes[slot].prev;
+    list->size--;
+    freeSlot(list, slot);
+    return value;
+}
+
+void insertAtK(struct List *list, int value, int k) {
+    uint32_t slot = allocSlot(list);
+    if (slot == NIL) { printf("Memory allocation failed!\n"); return; }
+    list->nodes[slot].data = value;
+
+    if (k <= 1 || list->size == 0) {
+        linkBefore(list, list->head, slot);
+        printf("Inserted %d at position 1\n", value);
+        return;
+    }
+
+    linkBefore(list, (uint32_t)k > list->size ? NIL : slotAt(list, k), slot);
+    printf("Inserted %d at position %d\n", value, k);
+}
+
+void deleteFromK(struct List *list, int k) {
+    if (list->size == 0) { printf("List is empty!\n"); return; }
+
+    if (k <= 1) {
+        printf("Deleted %d from position 1\n", unlinkSlot(list, list->head));
+        return;
+    }
+
+    if ((uint32_t)k > list->size) { printf("Position %d out of bounds\n", k); return; }
+
+    printf("Deleted %d from position %d\n", unlinkSlot(list, slotAt(list, k)), k);
+}
+
+/* Output for the display functions is built in a 4 KB chunk local to each call: numbers are
+   converted by hand and every full chunk goes out in one write() instead of one printf per node */
+#define OUT_CHUNK 4096
+
+struct Output {
+    char text[OUT_CHUNK];
+    size_t used;
+};
+
+void outFlush(struct Output *out) {
+    size_t done = 0;
+    fflush(stdout);
+    while (done < out->used) {
+        ssize_t n = write(STDOUT_FILENO, out->text + done, out->used - done);
+        if (n <= 0) break;
+        done += n;
+    }
+    out->used = 0;
+}
+
+void outText(struct Output *out, const char *text) {
+    while (*text != '\0') {
+        if (out->used == OUT_CHUNK) outFlush(out);
+        out->text[out->used++] = *text++;
+    }
+}
+
+void outInt(struct Output *out, int value) {
+    char digits[12];
+    int n = 0;
+    unsigned magnitude = value < 0 ? 0u - (unsigned)value : (unsigned)value;
+    if (out->used + sizeof(digits) > OUT_CHUNK) outFlush(out);
+    do {
+        digits[n++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude != 0);
+    if (value < 0) out->text[out->used++] = '-';
+    while (n > 0) out->text[out->used++] = digits[--n];
+}
+
+void display(struct List *list) {
+    if (list->size == 0) { printf("List is empty\n"); return; }
+    struct Output out;
+    out.used = 0;
+    outText(&out, "List: ");
+    for (uint32_t slot = list->head; slot != NIL; slot = list->nodes[slot].next) {
+        prefetchAhead(list, slot);
+        outInt(&out, list->nodes[slot].data);
+        if (list->nodes[slot].next != NIL) outText(&out, " <-> ");
+    }
+    outText(&out, "\n");
+    outFlush(&out);
+}
+
+void search(struct List *list, int value) {
+    int pos = 1;
+    for (uint32_t slot = list->head; slot != NIL; slot = list->nodes[slot].next) {
+        prefetchAhead(list, slot);
+        if (list->nodes[slot].data == value) {
+            printf("Found %d at position %d\n", value, pos);
+            return;
+        }
+        pos++;
+    }
+    printf("%d not found\n", value);
+}
+
+/* Renumbers nodes in traversal order, drops free slots and shrinks the array to fit */
+void compact(struct List *list) {
+    uint32_t capacity = list->size > INITIAL_CAPACITY ? list->size : INITIAL_CAPACITY;
+    struct Node *nodes = malloc((size_t)capacity * sizeof(struct Node));
+    if (!nodes) { printf("Memory allocation failed!\n"); return; }
+
+    uint32_t i = 0;
+    for (uint32_t slot = list->head; slot != NIL; slot = list->nodes[slot].next, i++) {
+        nodes[i].data = list->nodes[slot].data;
+        nodes[i].prev = i == 0 ? NIL : i - 1;
+        nodes[i].next = i + 1 == list->size ? NIL : i + 1;
+    }
+
+    free(list->nodes);
+    list->nodes = nodes;
+    list->capacity = capacity;
+    list->used = list->size;
+    list->freeHead = NIL;
+    list->head = list->size ? 0 : NIL;
+    list->tail = list->size ? list->size - 1 : NIL;
+    printf("Compacted %u nodes\n", list->size);
+}
+
+void stats(struct List *list) {
+    size_t bytes = (size_t)list->capacity * sizeof(struct Node);
+    printf("Nodes: %u, slots used: %u, free slots: %u, capacity: %u\n",
+           list->size, list->used, list->used - list->size, list->capacity);
+    printf("Node size: %zu bytes, array: %zu bytes", sizeof(struct Node), bytes);
+    if (list->size) printf(" (%.1f bytes per element)", (double)bytes / list->size);
+    printf("\n");
+}
+
+void displayMenu() {
+    printf("\n===== COMPACT DOUBLY LINKED LIST MENU =====\n");
+    printf("1. Insert at position k\n");
+    printf("2. Delete from position k\n");
+    printf("3. Display list\n");
+    printf("4. Search value\n");
+    printf("5. Compact\n");
+    printf("6. Memory statistics\n");
+    printf("0. Exit\n");
+    printf("Enter your choice: ");
+}
+
+int main() {
+    struct List list;
+    int ch, val, k;
+    initList(&list);
+    while (1) {
+        displayMenu();
+        scanf("%d", &ch);
+        switch (ch) {
+            case 1: printf("Enter value and position: "); scanf("%d%d", &val, &k); insertAtK(&list, val, k); break;
+            case 2: printf("Enter position to delete: "); scanf("%d", &k); deleteFromK(&list, k); break;
+            case 3: display(&list); break;
+            case 4: printf("Enter value to search: "); scanf("%d", &val); search(&list, val); break;
+            case 5: compact(&list); break;
+            case 6: stats(&list); break;
+            case 0: free(list.nodes); exit(0);
+            default: printf("Invalid choice\n");
+        }
+    }
+    return 0;
+}
@@ -9,74 +9,405 @@ Problem Statement: Write a menu driven program in C to perform the following ope
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <unistd.h>
 
 struct Node {
     int data;
     struct Node *prev;
     struct Node *next;
+    struct IndexLink *link;
 };
 
-void insertAtK(struct Node **head, int value, int k) {
+/* Optional side index: a hash multimap from value to the nodes holding it. Each distinct value
+   keeps a chain of links in head-to-tail order and every node points at its own link, so adding
+   or removing a node is O(1) and the first occurrence of a value is found without a scan */
+struct IndexLink {
+    struct Node *node;
+    struct IndexLink *prev;
+    struct IndexLink *next;
+};
+
+struct IndexEntry {
+    int value;
+    struct IndexLink *first;
+    struct IndexLink *last;
+    struct IndexEntry *next;
+};
+
+struct ValueIndex {
+    struct IndexEntry **buckets;
+    int bucketCount;
+    int count;
+};
+
+int indexEnabled(struct ValueIndex *index) {
+    return index->buckets != NULL;
+}
+
+unsigned indexSlot(struct ValueIndex *index, int value) {
+    unsigned h = (unsigned)value * 2654435761u;
+    return (h ^ (h >> 16)) & (index->bucketCount - 1);
+}
+
+int indexResize(struct ValueIndex *index, int bucketCount) {
+    struct IndexEntry **buckets = calloc(bucketCount, sizeof(struct IndexEntry *));
+    if (buckets == NULL) {
+        printf("Memory allocation failed!\n");
+        return 0;
+    }
+    struct IndexEntry **old = index->buckets;
+    int oldCount = index->bucketCount;
+    index->buckets = buckets;
+    index->bucketCount = bucketCount;
+    for (int i = 0; i < oldCount; i++) {
+        while (old[i] != NULL) {
+            struct IndexEntry *entry = old[i];
+            old[i] = entry->next;
+            unsigned slot = indexSlot(index, entry->value);
+            entry->next = buckets[slot];
+            buckets[slot] = entry;
+        }
+    }
+    free(old);
+    return 1;
+}
+
+struct IndexEntry* indexLookup(struct ValueIndex *index, int value) {
+    struct IndexEntry *entry = index->buckets[indexSlot(index, value)];
+    while (entry != NULL && entry->value != value) {
+        entry = entry->next;
+    }
+    return entry;
+}
+
+void indexFree(struct ValueIndex *index) {
+    for (int i = 0; i < index->bucketCount; i++) {
+        while (index->buckets[i] != NULL) {
+            struct IndexEntry *entry = index->buckets[i];
+            index->buckets[i] = entry->next;
+            while (entry->first != NULL) {
+                struct IndexLink *link = entry->first;
+                entry->first = link->next;
+                link->node->link = NULL;
+                free(link);
+            }
+            free(entry);
+        }
+    }
+    free(index->buckets);
+    index->buckets = NULL;
+    index->bucketCount = 0;
+    index->count = 0;
+}
+
+/* An index missing a node would give wrong answers, so running out of memory turns it off */
+void indexFail(struct ValueIndex *index) {
+    indexFree(index);
+    printf("Memory allocation failed! Value index disabled\n");
+}
+
+/* Adds node to its value's chain right after sameBefore, the nearest earlier node holding the
+   same value, or at the front of the chain when there is none */
+void indexAdd(struct ValueIndex *index, struct Node *node, struct Node *sameBefore) {
+    if (!indexEnabled(index)) return;
+    struct IndexEntry *entry = indexLookup(index, node->data);
+    if (entry == NULL) {
+        if (index->count >= index->bucketCount && !indexResize(index, index->bucketCount * 2)) {
+            indexFail(index);
+            return;
+        }
+        entry = malloc(sizeof(struct IndexEntry));
+        if (entry == NULL) {
+            indexFail(index);
+            return;
+        }
+        unsigned slot = indexSlot(index, node->data);
+        entry->value = node->data;
+        entry->first = entry->last = NULL;
+        entry->next = index->buckets[slot];
+        index->buckets[slot] = entry;
+        index->count++;
+    }
+    struct IndexLink *link = malloc(sizeof(struct IndexLink));
+    if (link == NULL) {
+        indexFail(index);
+        return;
+    }
+    link->node = node;
+    link->prev = sameBefore != NULL ? sameBefore->link : NULL;
+    link->next = link->prev != NULL ? link->prev->next : entry->first;
+    if (link->prev != NULL) link->prev->next = link;
+    else entry->first = link;
+    if (link->next != NULL) link->next->prev = link;
+    else entry->last = link;
+    node->link = link;
+}
+
+/* The node just before sameAfter in value's chain, or the chain's last node when sameAfter is NULL */
+struct Node* indexBefore(struct ValueIndex *index, int value, struct Node *sameAfter) {
+    if (!indexEnabled(index)) return NULL;
+    struct IndexLink *link;
+    if (sameAfter != NULL) {
+        link = sameAfter->link->prev;
+    } else {
+        struct IndexEntry *entry = indexLookup(index, value);
+        link = entry != NULL ? entry->last : NULL;
+    }
+    return link != NULL ? link->node : NULL;
+}
+
+void indexRemove(struct ValueIndex *index, struct Node *node) {
+    struct IndexLink *link = node->link;
+    if (link == NULL) return;
+    node->link = NULL;
+    if (link->prev != NULL && link->next != NULL) {
+        link->prev->next = link->next;
+        link->next->prev = link->prev;
+        free(link);
+        return;
+    }
+
+    struct IndexEntry **slot = &index->buckets[indexSlot(index, node->data)];
+    while ((*slot)->value != node->data) {
+        slot = &(*slot)->next;
+    }
+    struct IndexEntry *entry = *slot;
+    if (link->prev != NULL) link->prev->next = link->next;
+    else entry->first = link->next;
+    if (link->next != NULL) link->next->prev = link->prev;
+    else entry->last = link->prev;
+    free(link);
+    if (entry->first == NULL) {
+        *slot = entry->next;
+        free(entry);
+        index->count--;
+    }
+}
+
+struct Node* indexFind(struct ValueIndex *index, int value) {
+    struct IndexEntry *entry = indexLookup(index, value);
+    return entry != NULL ? entry->first->node : NULL;
+}
+
+struct List {
+    struct Node *head;
+    struct Node *tail;
+    int size;
+    struct ValueIndex index;
+};
+
+void initList(struct List *list) {
+    list->head = list->tail = NULL;
+    list->size = 0;
+    list->index.buckets = NULL;
+    list->index.bucketCount = 0;
+    list->index.count = 0;
+}
+
+/* Walks from whichever end is closer, so no position is more than size/2 hops away */
+struct Node* nodeAt(struct List *list, int k) {
+    struct Node *temp;
+    if (k <= (list->size + 1) / 2) {
+        temp = list->head;
+        for (int i = 1; i < k; i++)
+            temp = temp->next;
+    } else {
+        temp = list->tail;
+        for (int i = list->size; i > k; i--)
+            temp = temp->prev;
+    }
+    return temp;
+}
+
+/* nodeAt for inserts: also finds the nearest node before position k holding value, which is
+   where a node inserted at k joins that value's index chain. Either walk passes the nodes it
+   needs, so keeping the chain in list order costs no extra hops */
+struct Node* insertionPoint(struct List *list, int k, int value, struct Node **sameBefore) {
+    struct Node *temp, *same = NULL;
+    if (k <= (list->size + 1) / 2) {
+        temp = list->head;
+        for (int i = 1; i < k; i++) {
+            if (temp->data == value) same = temp;
+            temp = temp->next;
+        }
+        *sameBefore = same;
+    } else {
+        temp = list->tail;
+        for (int i = list->size; ; i--) {
+            if (temp->data == value) same = temp;
+            if (i == k) break;
+            temp = temp->prev;
+        }
+        *sameBefore = indexBefore(&list->index, value, same);
+    }
+    return temp;
+}
+
+/* Links newNode in front of next, or at the tail when next is NULL; sameBefore places it in the index */
+void linkBefore(struct List *list, struct Node *next, struct Node *newNode, struct Node *sameBefore) {
+    newNode->next = next;
+    newNode->prev = next ? next->prev : list->tail;
+    if (newNode->prev) newNode->prev->next = newNode;
+    else list->head = newNode;
+    if (next) next->prev = newNode;
+    else list->tail = newNode;
+    list->size++;
+    indexAdd(&list->index, newNode, sameBefore);
+}
+
+int unlinkNode(struct List *list, struct Node *temp) {
+    int value = temp->data;
+    indexRemove(&list->index, temp);
+    if (temp->prev) temp->prev->next = temp->next;
+    else list->head = temp->next;
+    if (temp->next) temp->next->prev = temp->prev;
+    else list->tail = temp->prev;
+    list->size--;
+    free(temp);
+    return value;
+}
+
+struct Node* createNode(int value) {
     struct Node *newNode = malloc(sizeof(struct Node));
-    if (!newNode) { printf("Memory allocation failed!\n"); return; }
+    if (!newNode) { printf("Memory allocation failed!\n"); return NULL; }
     newNode->data = value;
     newNode->prev = newNode->next = NULL;
+    newNode->link = NULL;
+    return newNode;
+}
 
-    if (k <= 1 || *head == NULL) {
-        newNode->next = *head;
-        if (*head) (*head)->prev = newNode;
-        *head = newNode;
+void insertAtK(struct List *list, int value, int k) {
+    struct Node *newNode = createNode(value);
+    if (!newNode) return;
+
+    if (k <= 1 || list->head == NULL) {
+        linkBefore(list, list->head, newNode, NULL);
         printf("Inserted %d at position 1\n", value);
         return;
     }
 
-    struct Node *temp = *head;
-    for (int i = 1; i < k - 1 && temp->next; i++)
-        temp = temp->next;
-
-    newNode->next = temp->next;
-    newNode->prev = temp;
-    if (temp->next) temp->next->prev = newNode;
-    temp->next = newNode;
-
+    struct Node *next = NULL, *sameBefore;
+    if (k > list->size) sameBefore = indexBefore(&list->index, value, NULL);
+    else next = insertionPoint(list, k, value, &sameBefore);
+    linkBefore(list, next, newNode, sameBefore);
     printf("Inserted %d at position %d\n", value, k);
 }
 
-void deleteFromK(struct Node **head, int k) {
-    if (*head == NULL) { printf("List is empty!\n"); return; }
+void deleteFromK(struct List *list, int k) {
+    if (list->head == NULL) { printf("List is empty!\n"); return; }
 
-    struct Node *temp = *head;
     if (k <= 1) {
-        *head = temp->next;
-        if (*head) (*head)->prev = NULL;
-        printf("Deleted %d from position 1\n", temp->data);
-        free(temp);
+        printf("Deleted %d from position 1\n", unlinkNode(list, list->head));
         return;
     }
 
-    for (int i = 1; i < k && temp; i++)
-        temp = temp->next;
+    if (k > list->size) { printf("Position %d out of bounds\n", k); return; }
 
-    if (!temp) { printf("Position %d out of bounds\n", k); return; }
+    printf("Deleted %d from position %d\n", unlinkNode(list, nodeAt(list, k)), k);
+}
 
-    if (temp->prev) temp->prev->next = temp->next;
-    if (temp->next) temp->next->prev = temp->prev;
-    printf("Deleted %d from position %d\n", temp->data, k);
-    free(temp);
+void pushFront(struct List *list, int value) {
+    struct Node *newNode = createNode(value);
+    if (!newNode) return;
+    linkBefore(list, list->head, newNode, NULL);
+    printf("Pushed %d at front\n", value);
+}
+
+void pushBack(struct List *list, int value) {
+    struct Node *newNode = createNode(value);
+    if (!newNode) return;
+    linkBefore(list, NULL, newNode, indexBefore(&list->index, value, NULL));
+    printf("Pushed %d at back\n", value);
+}
+
+void popFront(struct List *list) {
+    if (!list->head) { printf("List is empty!\n"); return; }
+    printf("Popped %d from front\n", unlinkNode(list, list->head));
+}
+
+void popBack(struct List *list) {
+    if (!list->tail) { printf("List is empty!\n"); return; }
+    printf("Popped %d from back\n", unlinkNode(list, list->tail));
+}
+
+/* Output for the display functions is built in a 4 KB chunk local to each call: numbers are
+   converted by hand and every full chunk goes out in one write() instead of one printf per node */
+#define OUT_CHUNK 4096
+
+struct Output {
+    char text[OUT_CHUNK];
+    size_t used;
+};
+
+void outFlush(struct Output *out) {
+    size_t done = 0;
+    fflush(stdout);
+    while (done < out->used) {
+        ssize_t n = write(STDOUT_FILENO, out->text + done, out->used - done);
+        if (n <= 0) break;
+        done += n;
+    }
+    out->used = 0;
 }
 
-void display(struct Node *head) {
+void outText(struct Output *out, const char *text) {
+    while (*text != '\0') {
+        if (out->used == OUT_CHUNK) outFlush(out);
+        out->text[out->used++] = *text++;
+    }
+}
+
+void outInt(struct Output *out, int value) {
+    char digits[12];
+    int n = 0;
+    unsigned magnitude = value < 0 ? 0u - (unsigned)value : (unsigned)value;
+    if (out->used + sizeof(digits) > OUT_CHUNK) outFlush(out);
+    do {
+        digits[n++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude != 0);
+    if (value < 0) out->text[out->used++] = '-';
+    while (n > 0) out->text[out->used++] = digits[--n];
+}
+
+void display(struct List *list) {
+    struct Node *head = list->head;
     if (!head) { printf("List is empty\n"); return; }
-    printf("List: ");
+    struct Output out;
+    out.used = 0;
+    outText(&out, "List: ");
     while (head) {
-        printf("%d", head->data);
-        if (head->next) printf(" <-> ");
+        outInt(&out, head->data);
+        if (head->next) outText(&out, " <-> ");
         head = head->next;
     }
-    printf("\n");
+    outText(&out, "\n");
+    outFlush(&out);
 }
 
-void search(struct Node *head, int value) {
+/* Reverse iteration: start at list->tail and follow prev */
+void displayReverse(struct List *list) {
+    struct Node *temp = list->tail;
+    if (!temp) { printf("List is empty\n"); return; }
+    struct Output out;
+    out.used = 0;
+    outText(&out, "Reverse: ");
+    while (temp) {
+        outInt(&out, temp->data);
+        if (temp->prev) outText(&out, " <-> ");
+        temp = temp->prev;
+    }
+    outText(&out, "\n");
+    outFlush(&out);
+}
+
+/* Search reports a position, so it still walks; the index only rules out missing values */
+void search(struct List *list, int value) {
+    if (indexEnabled(&list->index) && indexFind(&list->index, value) == NULL) {
+        printf("%d not found\n", value);
+        return;
+    }
+    struct Node *head = list->head;
     int pos = 1;
     while (head) {
         if (head->data == value) {
@@ -89,28 +420,192 @@ void search(struct Node *head, int value) {
     printf("%d not found\n", value);
 }
 
+struct Node* findNode(struct List *list, int value) {
+    if (indexEnabled(&list->index)) return indexFind(&list->index, value);
+    struct Node *temp = list->head;
+    while (temp && temp->data != value)
+        temp = temp->next;
+    return temp;
+}
+
+void contains(struct List *list, int value) {
+    printf("%d is %sin the list\n", value, findNode(list, value) ? "" : "not ");
+}
+
+/* Removes the first occurrence of value; with the index that node is the head of the value's
+   chain and is unlinked in O(1), since it knows its neighbours */
+void deleteByValue(struct List *list, int value) {
+    struct Node *temp = findNode(list, value);
+    if (!temp) { printf("%d not found\n", value); return; }
+
+    unlinkNode(list, temp);
+    printf("Deleted %d\n", value);
+}
+
+void toggleIndex(struct List *list) {
+    if (indexEnabled(&list->index)) {
+        indexFree(&list->index);
+        printf("Value index disabled\n");
+        return;
+    }
+    int bucketCount = 16;
+    while (bucketCount < list->size)
+        bucketCount *= 2;
+    if (!indexResize(&list->index, bucketCount)) return;
+    for (struct Node *temp = list->head; temp && indexEnabled(&list->index); temp = temp->next)
+        indexAdd(&list->index, temp, indexBefore(&list->index, temp->data, NULL));
+    if (indexEnabled(&list->index)) printf("Value index enabled (%d entries)\n", list->index.count);
+}
+
+/* Stable merge of two sorted chains along next; prev links are fixed by relinkPrev */
+struct Node* mergeChains(struct Node *a, struct Node *b, struct Node **tail) {
+    struct Node dummy, *last = &dummy;
+    while (a && b) {
+        if (a->data <= b->data) { last->next = a; a = a->next; }
+        else { last->next = b; b = b->next; }
+        last = last->next;
+    }
+    last->next = a ? a : b;
+    while (last->next) last = last->next;
+    *tail = last;
+    return dummy.next;
+}
+
+/* Detaches the first n nodes of chain and returns the rest */
+struct Node* cutChain(struct Node *chain, int n) {
+    for (int i = 1; i < n && chain; i++) chain = chain->next;
+    if (!chain) return NULL;
+    struct Node *rest = chain->next;
+    chain->next = NULL;
+    return rest;
+}
+
+/* Rebuilds prev pointers and the tail after the next chain has been relinked */
+void relinkPrev(struct List *list) {
+    struct Node *prev = NULL;
+    for (struct Node *cur = list->head; cur; cur = cur->next) {
+        cur->prev = prev;
+        prev = cur;
+    }
+    list->tail = prev;
+}
+
+/* Bottom-up merge sort over runs of width 1, 2, 4, ...; relinks nodes with O(1) extra space */
+void sortNodes(struct List *list) {
+    struct Node dummy, *tail;
+    dummy.next = list->head;
+    for (int width = 1; width < list->size; width *= 2) {
+        struct Node *prev = &dummy, *cur = dummy.next;
+        while (cur) {
+            struct Node *left = cur;
+            struct Node *right = cutChain(left, width);
+            cur = cutChain(right, width);
+            prev->next = mergeChains(left, right, &tail);
+            prev = tail;
+        }
+    }
+    list->head = dummy.next;
+    relinkPrev(list);
+}
+
+int isSorted(struct List *list) {
+    for (struct Node *cur = list->head; cur && cur->next; cur = cur->next)
+        if (cur->data > cur->next->data) return 0;
+    return 1;
+}
+
+void sortList(struct List *list) {
+    if (!list->head) { printf("List is empty\n"); return; }
+    sortNodes(list);
+    printf("List sorted\n");
+}
+
+/* Merges sorted other into sorted list in O(n + m), moving other's nodes over. The merge is stable
+   and takes list's node first on ties, so other's nodes go to the back of their value chains */
+void mergeLists(struct List *list, struct List *other) {
+    struct Node *tail;
+    if (indexEnabled(&list->index))
+        for (struct Node *cur = other->head; cur; cur = cur->next)
+            indexAdd(&list->index, cur, indexBefore(&list->index, cur->data, NULL));
+    list->head = mergeChains(list->head, other->head, &tail);
+    list->size += other->size;
+    relinkPrev(list);
+    indexFree(&other->index);
+    initList(other);
+}
+
+void mergeSorted(struct List *list) {
+    struct List other;
+    int n, val;
+    initList(&other);
+    printf("Enter number of elements in the second list: ");
+    scanf("%d", &n);
+    printf("Enter %d elements: ", n);
+    for (int i = 0; i < n; i++) {
+        scanf("%d", &val);
+        struct Node *newNode = createNode(val);
+        if (newNode) linkBefore(&other, NULL, newNode, NULL);
+    }
+    if (!isSorted(list)) { printf("List is not sorted, sorting it first\n"); sortNodes(list); }
+    if (!isSorted(&other)) sortNodes(&other);
+    mergeLists(list, &other);
+    printf("Merged %d elements, list now has %d\n", n, list->size);
+}
+
+void freeList(struct List *list) {
+    indexFree(&list->index);
+    while (list->head) {
+        struct Node *temp = list->head;
+        list->head = temp->next;
+        free(temp);
+    }
+    list->tail = NULL;
+    list->size = 0;
+}
+
 void displayMenu() {
     printf("\n===== DOUBLY LINKED LIST MENU =====\n");
     printf("1. Insert at position k\n");
     printf("2. Delete from position k\n");
     printf("3. Display list\n");
     printf("4. Search value\n");
+    printf("5. Check membership\n");
+    printf("6. Delete by value\n");
+    printf("7. Enable/disable value index\n");
+    printf("8. Push front\n");
+    printf("9. Push back\n");
+    printf("10. Pop front\n");
+    printf("11. Pop back\n");
+    printf("12. Display in reverse\n");
+    printf("13. Sort list\n");
+    printf("14. Merge another sorted list\n");
     printf("0. Exit\n");
     printf("Enter your choice: ");
 }
 
 int main() {
-    struct Node *head = NULL;
+    struct List list;
     int ch, val, k;
+    initList(&list);
     while (1) {
         displayMenu();
         scanf("%d", &ch);
         switch (ch) {
-            case 1: printf("Enter value and position: "); scanf("%d%d", &val, &k); insertAtK(&head, val, k); break;
-            case 2: printf("Enter position to delete: "); scanf("%d", &k); deleteFromK(&head, k); break;
-            case 3: display(head); break;
-            case 4: printf("Enter value to search: "); scanf("%d", &val); search(head, val); break;
-            case 0: exit(0);
+            case 1: printf("Enter value and position: "); scanf("%d%d", &val, &k); insertAtK(&list, val, k); break;
+            case 2: printf("Enter position to delete: "); scanf("%d", &k); deleteFromK(&list, k); break;
+            case 3: display(&list); break;
+            case 4: printf("Enter value to search: "); scanf("%d", &val); search(&list, val); break;
+            case 5: printf("Enter value to check: "); scanf("%d", &val); contains(&list, val); break;
+            case 6: printf("Enter value to delete: "); scanf("%d", &val); deleteByValue(&list, val); break;
+            case 7: toggleIndex(&list); break;
+            case 8: printf("Enter value: "); scanf("%d", &val); pushFront(&list, val); break;
+            case 9: printf("Enter value: "); scanf("%d", &val); pushBack(&list, val); break;
+            case 10: popFront(&list); break;
+            case 11: popBack(&list); break;
+            case 12: displayReverse(&list); break;
+            case 13: sortList(&list); break;
+            case 14: mergeSorted(&list); break;
+            case 0: freeList(&list); exit(0);
             default: printf("Invalid choice\n");
         }
     }
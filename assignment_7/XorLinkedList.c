@@ -0,0 +1,437 @@
+/*
+ASSIGNMENT 7 (XOR variant):
+Memory-lean doubly linked list where each node stores prev XOR next in a single link field.
+Knowing one neighbour is enough to recover the other, so the list can be walked from the
+head or from the tail, and both ends support O(1) insert and delete.
+Nodes come from a block arena instead of one malloc each, since malloc would round a 16-byte
+node up to a 32-byte chunk and give back the saving.
+Menu option 9 benchmarks memory footprint, build and traversal speed against a regular doubly
+linked list that takes its nodes from the same kind of arena.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+
+struct Node {
+    int data;
+    uintptr_t link;
+};
+
+#define FIRST_BLOCK_NODES 32
+#define MAX_BLOCK_NODES 65536
+
+/* Nodes are carved out of blocks that grow geometrically up to MAX_BLOCK_NODES. nodeSize lets the
+   benchmark's doubly linked list use the same allocator */
+struct NodeBlock {
+    struct NodeBlock *next;
+    int capacity;
+    max_align_t nodes[];
+};
+
+struct NodeArena {
+    struct NodeBlock *blocks;
+    int used;
+    size_t nodeSize;
+    size_t bytes;
+    void *freeList;
+};
+
+void initArena(struct NodeArena *arena, size_t nodeSize) {
+    arena->blocks = NULL;
+    arena->used = 0;
+    arena->nodeSize = nodeSize;
+    arena->bytes = 0;
+    arena->freeList = NULL;
+}
+
+void* allocNode(struct NodeArena *arena) {
+    if (arena->freeList) {
+        void *node = arena->freeList;
+        arena->freeList = *(void **)node;
+        return node;
+    }
+
+    if (!arena->blocks || arena->used == arena->blocks->capacity) {
+        int capacity = FIRST_BLOCK_NODES;
+        if (arena->blocks && arena->blocks->capacity < MAX_BLOCK_NODES) capacity = arena->blocks->capacity * 2;
+        else if (arena->blocks) capacity = MAX_BLOCK_NODES;
+        size_t size = sizeof(struct NodeBlock) + capacity * arena->nodeSize;
+        struct NodeBlock *block = malloc(size);
+        if (!block) return NULL;
+        block->capacity = capacity;
+        block->next = arena->blocks;
+        arena->blocks = block;
+        arena->used = 0;
+        arena->bytes += size;
+    }
+    return (char *)arena->blocks->nodes + arena->nodeSize * arena->used++;
+}
+
+/* Deleted nodes are kept for reuse; memory goes back only when the list is freed */
+void releaseNode(struct NodeArena *arena, void *node) {
+    *(void **)node = arena->freeList;
+    arena->freeList = node;
+}
+
+void freeArena(struct NodeArena *arena) {
+    while (arena->blocks) {
+        struct NodeBlock *block = arena->blocks;
+        arena->blocks = block->next;
+        free(block);
+    }
+    initArena(arena, arena->nodeSize);
+}
+
+struct List {
+    struct Node *head;
+    struct Node *tail;
+    int size;
+    struct NodeArena arena;
+};
+
+void initList(struct List *list) {
+    list->head = list->tail = NULL;
+    list->size = 0;
+    initArena(&list->arena, sizeof(struct Node));
+}
+
+struct Node* XOR(struct Node *a, struct Node *b) {
+    return (struct Node *)((uintptr_t)a ^ (uintptr_t)b);
+}
+
+/* Finds the node at position k (NULL for size + 1) and the node before it, from the nearer end */
+void locate(struct List *list, int k, struct Node **prev, struct Node **cur) {
+    if (k <= (list->size + 1) / 2) {
+        struct Node *p = NULL, *c = list->head;
+        for (int i = 1; i < k; i++) {
+            struct Node *next = XOR(p, (struct Node *)c->link);
+            p = c;
+            c = next;
+        }
+        *prev = p;
+        *cur = c;
+    } else {
+        struct Node *next = NULL, *c = list->tail;
+        for (int i = list->size; i > k; i--) {
+            struct Node *p = XOR(next, (struct Node *)c->link);
+            next = c;
+            c = p;
+        }
+        if (k == list->size + 1) {
+            *prev = list->tail;
+            *cur = NULL;
+        } else {
+            *prev = XOR(next, (struct Node *)c->link);
+            *cur = c;
+        }
+    }
+}
+
+/* Links newNode between two adjacent nodes (either may be NULL at the ends) */
+void linkBetween(struct List *list, struct Node *prev, struct Node *next, struct Node *newNode) {
+    newNode->link = (uintptr_t)XOR(prev, next);
+    if (prev) prev->link ^= (uintptr_t)next ^ (uintptr_t)newNode;
+    else list->head = newNode;
+    if (next) next->link ^= (uintptr_t)prev ^ (uintptr_t)newNode;
+    else list->tail = newNode;
+    list->size++;
+}
+
+int unlinkNode(struct List *list, struct Node *prev, struct Node *node) {
+    struct Node *next = XOR(prev, (struct Node *)node->link);
+    int value = node->data;
+    if (prev) prev->link ^= (uintptr_t)node ^ (uintptr_t)next;
+    else list->head = next;
+    if (next) next->link ^= (uintptr_t)node ^ (uintptr_t)prev;
+    else list->tail = prev;
+    list->size--;
+    releaseNode(&list->arena, node);
+    return value;
+}
+
+struct Node* createNode(struct List *list, int value) {
+    struct Node *newNode = allocNode(&list->arena);
+    if (!newNode) { printf("Memory allocation failed!\n"); return NULL; }
+    newNode->data = value;
+    newNode->link = 0;
+    return newNode;
+}
+
+/* Same position rules as DoublyLinkedList.c: k <= 1 inserts at the front, k past the end appends */
+void insertAtK(struct List *list, int value, int k) {
+    struct Node *newNode = createNode(list, value);
+    if (!newNode) return;
+
+    if (k <= 1 || list->head == NULL) {
+        linkBetween(list, NULL, list->head, newNode);
+        printf("Inserted %d at position 1\n", value);
+        return;
+    }
+
+    struct Node *prev, *cur;
+    locate(list, k > list->size ? list->size + 1 : k, &prev, &cur);
+    linkBetween(list, prev, cur, newNode);
+    printf("Inserted %d at position %d\n", value, k);
+}
+
+void deleteFromK(struct List *list, int k) {
+    if (list->size == 0) { printf("List is empty!\n"); return; }
+
+    if (k <= 1) {
+        printf("Deleted %d from position 1\n", unlinkNode(list, NULL, list->head));
+        return;
+    }
+
+    if (k > list->size) { printf("Position %d out of bounds\n", k); return; }
+
+    struct Node *prev, *cur;
+    locate(list, k, &prev, &cur);
+    printf("Deleted %d from position %d\n", unlinkNode(list, prev, cur), k);
+}
+
+void pushFront(struct List *list, int value) {
+    struct Node *newNode = createNode(list, value);
+    if (!newNode) return;
+    linkBetween(list, NULL, list->head, newNode);
+    printf("Pushed %d at front\n", value);
+}
+
+int append(struct List *list, int value) {
+    struct Node *newNode = createNode(list, value);
+    if (!newNode) return 0;
+    linkBetween(list, list->tail, NULL, newNode);
+    return 1;
+}
+
+void pushBack(struct List *list, int value) {
+    if (append(list, value)) printf("Pushed %d at back\n", value);
+}
+
+void popFront(struct List *list) {
+    if (!list->head) { printf("List is empty!\n"); return; }
+    printf("Popped %d from front\n", unlinkNode(list, NULL, list->head));
+}
+
+void popBack(struct List *list) {
+    if (!list->tail) { printf("List is empty!\n"); return; }
+    struct Node *prev = (struct Node *)list->tail->link;
+    printf("Popped %d from back\n", unlinkNode(list, prev, list->tail));
+}
+
+/* Output for the display functions is built in a 4 KB chunk local to each call: numbers are
+   converted by hand and every full chunk goes out in one write() instead of one printf per node */
+#define OUT_CHUNK 4096
+
+struct Output {
+    char text[OUT_CHUNK];
+    size_t used;
+};
+
+void outFlush(struct Output *out) {
+    size_t done = 0;
+    fflush(stdout);
+    while (done < out->used) {
+        ssize_t n = write(STDOUT_FILENO, out->text + done, out->used - done);
+        if (n <= 0) break;
+        done += n;
+    }
+    out->used = 0;
+}
+
+void outText(struct Output *out, const char *text) {
+    while (*text != '\0') {
+        if (out->used == OUT_CHUNK) outFlush(out);
+        out->text[out->used++] = *text++;
+    }
+}
+
+void outInt(struct Output *out, int value) {
+    char digits[12];
+    int n = 0;
+    unsigned magnitude = value < 0 ? 0u - (unsigned)value : (unsigned)value;
+    if (out->used + sizeof(digits) > OUT_CHUNK) outFlush(out);
+    do {
+        digits[n++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude != 0);
+    if (value < 0) out->text[out->used++] = '-';
+    while (n > 0) out->text[out->used++] = digits[--n];
+}
+
+/* Walks from either end; the same loop works in both directions */
+void display(struct List *list, int backward) {
+    if (!list->head) { printf("List is empty\n"); return; }
+    struct Node *prev = NULL, *cur = backward ? list->tail : list->head;
+    struct Output out;
+    out.used = 0;
+    outText(&out, backward ? "Reverse: " : "List: ");
+    while (cur) {
+        struct Node *next = XOR(prev, (struct Node *)cur->link);
+        outInt(&out, cur->data);
+        if (next) outText(&out, " <-> ");
+        prev = cur;
+        cur = next;
+    }
+    outText(&out, "\n");
+    outFlush(&out);
+}
+
+/* Position of the first node holding value, or 0 */
+int findPosition(struct List *list, int value) {
+    struct Node *prev = NULL, *cur = list->head;
+    int pos = 1;
+    while (cur) {
+        struct Node *next = XOR(prev, (struct Node *)cur->link);
+        if (cur->data == value) return pos;
+        prev = cur;
+        cur = next;
+        pos++;
+    }
+    return 0;
+}
+
+void search(struct List *list, int value) {
+    int pos = findPosition(list, value);
+    if (pos) printf("Found %d at position %d\n", value, pos);
+    else printf("%d not found\n", value);
+}
+
+void freeList(struct List *list) {
+    freeArena(&list->arena);
+    list->head = list->tail = NULL;
+    list->size = 0;
+}
+
+/* Regular doubly linked list with the same arena, append and search, used only by the benchmark */
+struct DNode {
+    int data;
+    struct DNode *prev;
+    struct DNode *next;
+};
+
+struct DList {
+    struct DNode *head;
+    struct DNode *tail;
+    int size;
+    struct NodeArena arena;
+};
+
+int dAppend(struct DList *list, int value) {
+    struct DNode *node = allocNode(&list->arena);
+    if (!node) return 0;
+    node->data = value;
+    node->next = NULL;
+    node->prev = list->tail;
+    if (list->tail) list->tail->next = node;
+    else list->head = node;
+    list->tail = node;
+    list->size++;
+    return 1;
+}
+
+int dFindPosition(struct DList *list, int value) {
+    int pos = 1;
+    for (struct DNode *cur = list->head; cur; cur = cur->next, pos++)
+        if (cur->data == value) return pos;
+    return 0;
+}
+
+double seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Builds both lists with their own append and times full-length searches for a missing value */
+void benchmark(int n, int rounds) {
+    if (n < 1 || rounds < 1) { printf("Need at least one node and one round\n"); return; }
+    struct List xl;
+    struct DList dl;
+    initList(&xl);
+    dl.head = dl.tail = NULL;
+    dl.size = 0;
+    initArena(&dl.arena, sizeof(struct DNode));
+
+    int ok = 1;
+    double t = seconds();
+    for (int i = 0; i < n && ok; i++) ok = append(&xl, i);
+    double xBuild = seconds() - t;
+
+    t = seconds();
+    for (int i = 0; i < n && ok; i++) ok = dAppend(&dl, i);
+    double dBuild = seconds() - t;
+
+    if (!ok) {
+        printf("Memory allocation failed!\n");
+        freeList(&xl);
+        freeArena(&dl.arena);
+        return;
+    }
+
+    long long xMisses = 0, dMisses = 0;
+    t = seconds();
+    for (int r = 0; r < rounds; r++) xMisses += findPosition(&xl, -1 - r) == 0;
+    double xScan = seconds() - t;
+
+    t = seconds();
+    for (int r = 0; r < rounds; r++) dMisses += dFindPosition(&dl, -1 - r) == 0;
+    double dScan = seconds() - t;
+
+    printf("%-12s %10s %14s %12s %14s\n", "List", "node size", "arena bytes", "build (s)", "scan ns/node");
+    printf("%-12s %10zu %14zu %12.4f %14.2f\n", "XOR", sizeof(struct Node),
+           xl.arena.bytes, xBuild, xScan * 1e9 / ((double)n * rounds));
+    printf("%-12s %10zu %14zu %12.4f %14.2f\n", "Doubly", sizeof(struct DNode),
+           dl.arena.bytes, dBuild, dScan * 1e9 / ((double)n * rounds));
+    printf("Full scans: %lld %lld\n", xMisses, dMisses);
+
+    freeList(&xl);
+    freeArena(&dl.arena);
+}
+
+void displayMenu() {
+    printf("\n===== XOR LINKED LIST MENU =====\n");
+    printf("1. Insert at position k\n");
+    printf("2. Delete from position k\n");
+    printf("3. Display list\n");
+    printf("4. Display in reverse\n");
+    printf("5. Search value\n");
+    printf("6. Push front\n");
+    printf("7. Push back\n");
+    printf("8. Pop front / pop back\n");
+    printf("9. Benchmark against doubly linked list\n");
+    printf("0. Exit\n");
+    printf("Enter your choice: ");
+}
+
+int main() {
+    struct List list;
+    int ch, val, k;
+    initList(&list);
+    while (1) {
+        displayMenu();
+        scanf("%d", &ch);
+        switch (ch) {
+            case 1: printf("Enter value and position: "); scanf("%d%d", &val, &k); insertAtK(&list, val, k); break;
+            case 2: printf("Enter position to delete: "); scanf("%d", &k); deleteFromK(&list, k); break;
+            case 3: display(&list, 0); break;
+            case 4: display(&list, 1); break;
+            case 5: printf("Enter value to search: "); scanf("%d", &val); search(&list, val); break;
+            case 6: printf("Enter value: "); scanf("%d", &val); pushFront(&list, val); break;
+            case 7: printf("Enter value: "); scanf("%d", &val); pushBack(&list, val); break;
+            case 8:
+                printf("Pop from (1) front or (2) back: ");
+                scanf("%d", &k);
+                if (k == 1) popFront(&list);
+                else popBack(&list);
+                break;
+            case 9: printf("Enter number of nodes and scan rounds: "); scanf("%d%d", &val, &k); benchmark(val, k); break;
+            case 0: freeList(&list); exit(0);
+            default: printf("Invalid choice\n");
+        }
+    }
+    return 0;
+}
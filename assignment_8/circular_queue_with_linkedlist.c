@@ -9,6 +9,7 @@ Problem Statement: Write a menu driven program in C to implement a queue using s
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <unistd.h>
 
 struct NodeStruct {
     int data;
@@ -80,21 +81,65 @@ void dequeue() {
     queue.size--;
 }
 
+/* Output for the display functions is built in a 4 KB chunk local to each call: numbers are
+   converted by hand and every full chunk goes out in one write() instead of one printf per node */
+#define OUT_CHUNK 4096
+
+struct Output {
+    char text[OUT_CHUNK];
+    size_t used;
+};
+
+void outFlush(struct Output *out) {
+    size_t done = 0;
+    fflush(stdout);
+    while (done < out->used) {
+        ssize_t n = write(STDOUT_FILENO, out->text + done, out->used - done);
+        if (n <= 0) break;
+        done += n;
+    }
+    out->used = 0;
+}
+
+void outText(struct Output *out, const char *text) {
+    while (*text != '\0') {
+        if (out->used == OUT_CHUNK) outFlush(out);
+        out->text[out->used++] = *text++;
+    }
+}
+
+void outInt(struct Output *out, int value) {
+    char digits[12];
+    int n = 0;
+    unsigned magnitude = value < 0 ? 0u - (unsigned)value : (unsigned)value;
+    if (out->used + sizeof(digits) > OUT_CHUNK) outFlush(out);
+    do {
+        digits[n++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude != 0);
+    if (value < 0) out->text[out->used++] = '-';
+    while (n > 0) out->text[out->used++] = digits[--n];
+}
+
 void display() {
     if (isEmpty()) {
         printf("Queue is empty\n");
         return;
     }
     
-    printf("Queue contents: Front -> ");
+    struct Output out;
+    out.used = 0;
+    outText(&out, "Queue contents: Front -> ");
     Node *current = queue.rear->next;
     
     do {
-        printf("%d ", current->data);
+        outInt(&out, current->data);
+        outText(&out, " ");
         current = current->next;
     } while (current != queue.rear->next);
     
-    printf("<- Rear\n");
+    outText(&out, "<- Rear\n");
+    outFlush(&out);
 }
 
 void peek() {
@@ -0,0 +1,827 @@
+/*
+ASSIGNMENT 8 (adaptive variant):
+Polynomial addition where each polynomial picks its own representation.
+Dense polynomials (most exponents up to the degree are present) are stored as a plain
+coefficient array indexed by exponent, and addition is a straight element-wise loop the
+compiler vectorizes. Sparse polynomials are stored as two parallel sorted arrays (exps[] and
+coeffs[]) and added with a branch-light merge. Results are converted automatically.
+The two polynomials are also multiplied: schoolbook for short operands, Karatsuba in the
+middle range and a number-theoretic transform over three primes (combined by CRT) for long
+dense ones, while sparse products are generated in exponent order from a heap.
+Build with -O3 (gcc -O3 polynomial_adaptive.c) so the dense loop is vectorized.
+Run "./polynomial_adaptive bench" to measure the multiplication crossovers on this machine.
+*/
+
+#include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
+#include<limits.h>
+#include<time.h>
+
+/* A polynomial is stored dense when at least this percentage of the slots up to its degree are non-zero */
+#define DENSE_FILL_PERCENT 50
+
+/* Multiplication crossovers on the shorter operand length; "./polynomial_adaptive bench" measures them */
+#ifndef KARATSUBA_THRESHOLD
+#define KARATSUBA_THRESHOLD 64
+#endif
+#ifndef NTT_THRESHOLD
+#define NTT_THRESHOLD 4096
+#endif
+/* Largest product computed as a dense convolution, in coefficient slots */
+#define MAX_DENSE_PRODUCT (1 << 24)
+
+int karatsubaCutoff = KARATSUBA_THRESHOLD;
+int nttCutoff = NTT_THRESHOLD;
+
+struct Poly{
+    int dense;           /* 1: coeffs[e] is the coefficient of x^e; 0: terms sorted by exps[] */
+    int count;           /* dense: degree + 1, sparse: number of terms */
+    int capacity;
+    int *exps;           /* sparse only, strictly increasing */
+    long long *coeffs;
+};
+
+void initPoly(struct Poly* p){
+    p->dense = 0;
+    p->count = 0;
+    p->capacity = 0;
+    p->exps = NULL;
+    p->coeffs = NULL;
+}
+
+void freePoly(struct Poly* p){
+    free(p->exps);
+    free(p->coeffs);
+    initPoly(p);
+}
+
+/* Allocates room for n slots (zeroed when dense); returns 0 on failure */
+int allocPoly(struct Poly* p, int dense, int n){
+    freePoly(p);
+    p->dense = dense;
+    p->capacity = n;
+    if (n == 0) return 1;
+    p->coeffs = dense ? calloc(n, sizeof(long long)) : malloc(n * sizeof(long long));
+    p->exps = dense ? NULL : malloc(n * sizeof(int));
+    if (p->coeffs == NULL || (!dense && p->exps == NULL)){
+        printf("Memory allocation failed!\n");
+        freePoly(p);
+        return 0;
+    }
+    return 1;
+}
+
+int termCount(struct Poly* p){
+    if (!p->dense) return p->count;
+    int terms = 0;
+    for (int e = 0; e < p->count; e++) terms += p->coeffs[e] != 0;
+    return terms;
+}
+
+int degree(struct Poly* p){
+    if (p->count == 0) return -1;
+    return p->dense ? p->count - 1 : p->exps[p->count - 1];
+}
+
+size_t polyBytes(struct Poly* p){
+    return (size_t)p->count * (p->dense ? sizeof(long long) : sizeof(long long) + sizeof(int));
+}
+
+int wantsDense(long long terms, long long degree){
+    return terms > 0 && terms * 100 >= (degree + 1) * DENSE_FILL_PERCENT;
+}
+
+void toDense(struct Poly* p){
+    struct Poly d;
+    initPoly(&d);
+    if (!allocPoly(&d, 1, degree(p) + 1)) return;
+    for (int i = 0; i < p->count; i++) d.coeffs[p->exps[i]] = p->coeffs[i];
+    d.count = d.capacity;
+    freePoly(p);
+    *p = d;
+}
+
+/* Builds the sparse form of dense polynomial p in s */
+int sparseCopy(struct Poly* p, struct Poly* s){
+    if (!allocPoly(s, 0, termCount(p))) return 0;
+    for (int e = 0; e < p->count; e++){
+        if (p->coeffs[e] != 0){
+            s->exps[s->count] = e;
+            s->coeffs[s->count++] = p->coeffs[e];
+        }
+    }
+    return 1;
+}
+
+void toSparse(struct Poly* p){
+    struct Poly s;
+    initPoly(&s);
+    if (!sparseCopy(p, &s)) return;
+    freePoly(p);
+    *p = s;
+}
+
+/* Trims zero leading coefficients and switches representation when the fill crosses the threshold */
+void normalize(struct Poly* p){
+    if (p->dense){
+        while (p->count > 0 && p->coeffs[p->count - 1] == 0) p->count--;
+        if (!wantsDense(termCount(p), p->count - 1)) toSparse(p);
+    } else if (wantsDense(p->count, degree(p))){
+        toDense(p);
+    }
+}
+
+/* Dense + dense: one element-wise pass over restrict-qualified arrays, which vectorizes */
+void addDense(const long long* restrict a, int na, const long long* restrict b, int nb, long long* restrict r){
+    int common = na < nb ? na : nb;
+    for (int e = 0; e < common; e++) r[e] = a[e] + b[e];
+    if (na > common) memcpy(r + common, a + common, (na - common) * sizeof(long long));
+    if (nb > common) memcpy(r + common, b + common, (nb - common) * sizeof(long long));
+}
+
+/* Sparse + sparse: the merge step picks with conditional moves instead of a three-way branch */
+int addSparse(struct Poly* a, struct Poly* b, struct Poly* r){
+    int i = 0, j = 0, k = 0;
+    while (i < a->count && j < b->count){
+        int ea = a->exps[i], eb = b->exps[j];
+        int takeA = ea <= eb, takeB = eb <= ea;
+        long long c = (takeA ? a->coeffs[i] : 0) + (takeB ? b->coeffs[j] : 0);
+        r->exps[k] = takeA ? ea : eb;
+        r->coeffs[k] = c;
+        k += c != 0;
+        i += takeA;
+        j += takeB;
+    }
+    for (; i < a->count; i++, k++){
+        r->exps[k] = a->exps[i];
+        r->coeffs[k] = a->coeffs[i];
+    }
+    for (; j < b->count; j++, k++){
+        r->exps[k] = b->exps[j];
+        r->coeffs[k] = b->coeffs[j];
+    }
+    return k;
+}
+
+/* r = a + b; r must not alias a or b */
+int addPolynomials(struct Poly* a, struct Poly* b, struct Poly* r){
+    int n = degree(a) > degree(b) ? degree(a) + 1 : degree(b) + 1;
+    struct Poly* d = a->dense ? a : b;
+    struct Poly* other = a->dense ? b : a;
+
+    if (d->dense && !other->dense && !wantsDense(termCount(d) + other->count, n - 1)){
+        /* A small dense polynomial plus a far-reaching sparse one: merge in sparse form */
+        struct Poly s;
+        initPoly(&s);
+        if (!sparseCopy(d, &s)) return 0;
+        int ok = addPolynomials(&s, other, r);
+        freePoly(&s);
+        return ok;
+    }
+
+    if (!a->dense && !b->dense){
+        if (!allocPoly(r, 0, a->count + b->count)) return 0;
+        r->count = addSparse(a, b, r);
+    } else {
+        if (!allocPoly(r, 1, n)) return 0;
+        r->count = n;
+        if (other->dense){
+            addDense(a->coeffs, a->count, b->coeffs, b->count, r->coeffs);
+        } else {
+            memcpy(r->coeffs, d->coeffs, d->count * sizeof(long long));
+            for (int i = 0; i < other->count; i++) r->coeffs[other->exps[i]] += other->coeffs[i];
+        }
+    }
+    normalize(r);
+    return 1;
+}
+
+/* ---------- Multiplication ----------
+   The fast methods wrap modulo 2^64, which gives the exact product whenever the true
+   coefficients fit in 64 bits. When the operand sizes cannot rule out a larger coefficient,
+   the product is computed with checked arithmetic instead, and a coefficient that does not
+   fit is reported rather than printed wrapped. */
+
+typedef unsigned long long word;
+
+/* r[0..na+nb-2] += a * b */
+void mulSchoolbook(const word* a, int na, const word* b, int nb, word* r){
+    for (int i = 0; i < na; i++){
+        word ai = a[i];
+        for (int j = 0; j < nb; j++) r[i + j] += ai * b[j];
+    }
+}
+
+/* Checked schoolbook for karatsubaChecked(): returns 0 as soon as a step leaves 64 bits */
+int mulSchoolbookChecked(const long long* a, int na, const long long* b, int nb, long long* r){
+    for (int i = 0; i < na; i++){
+        for (int j = 0; j < nb; j++){
+            long long t;
+            if (__builtin_mul_overflow(a[i], b[j], &t) || __builtin_add_overflow(r[i + j], t, &r[i + j])) return 0;
+        }
+    }
+    return 1;
+}
+
+/* Exact schoolbook: each coefficient is summed in 128 bits, so 0 means one really does not fit */
+int mulExact(const long long* a, int na, const long long* b, int nb, long long* r){
+    for (int k = 0; k < na + nb - 1; k++){
+        int lo = k - nb + 1 > 0 ? k - nb + 1 : 0, hi = k < na - 1 ? k : na - 1;
+        __int128 sum = 0;
+        for (int i = lo; i <= hi; i++){
+            if (__builtin_add_overflow(sum, (__int128)a[i] * b[k - i], &sum)) return 0;
+        }
+        if (sum < LLONG_MIN || sum > LLONG_MAX) return 0;
+        r[k] = (long long)sum;
+    }
+    return 1;
+}
+
+/* r[0..2n-2] = a * b for two length-n operands; scratch needs 4n + 256 words */
+void karatsuba(const word* a, const word* b, int n, word* r, word* scratch){
+    if (n < karatsubaCutoff || n < 2){
+        memset(r, 0, (2 * n - 1) * sizeof(word));
+        mulSchoolbook(a, n, b, n, r);
+        return;
+    }
+    int h = n / 2, k = n - h;
+    word *sa = scratch, *sb = scratch + k, *z1 = scratch + 2 * k, *rest = scratch + 4 * k;
+
+    karatsuba(a, b, h, r, rest);
+    r[2 * h - 1] = 0;
+    karatsuba(a + h, b + h, k, r + 2 * h, rest);
+
+    for (int i = 0; i < k; i++){
+        sa[i] = a[h + i] + (i < h ? a[i] : 0);
+        sb[i] = b[h + i] + (i < h ? b[i] : 0);
+    }
+    karatsuba(sa, sb, k, z1, rest);
+    for (int i = 0; i < 2 * h - 1; i++) z1[i] -= r[i];
+    for (int i = 0; i < 2 * k - 1; i++) z1[i] -= r[2 * h + i];
+    for (int i = 0; i < 2 * k - 1; i++) r[h + i] += z1[i];
+}
+
+/* karatsuba() with every step checked; returns 0 as soon as an intermediate leaves 64 bits,
+   which the sums of halves can do even when the final coefficients fit */
+int karatsubaChecked(const long long* a, const long long* b, int n, long long* r, long long* scratch){
+    if (n < karatsubaCutoff || n < 2){
+        memset(r, 0, (2 * n - 1) * sizeof(long long));
+        return mulSchoolbookChecked(a, n, b, n, r);
+    }
+    int h = n / 2, k = n - h;
+    long long *sa = scratch, *sb = scratch + k, *z1 = scratch + 2 * k, *rest = scratch + 4 * k;
+
+    if (!karatsubaChecked(a, b, h, r, rest)) return 0;
+    r[2 * h - 1] = 0;
+    if (!karatsubaChecked(a + h, b + h, k, r + 2 * h, rest)) return 0;
+
+    for (int i = 0; i < k; i++){
+        sa[i] = a[h + i];
+        sb[i] = b[h + i];
+        if (i < h && (__builtin_add_overflow(sa[i], a[i], &sa[i]) || __builtin_add_overflow(sb[i], b[i], &sb[i]))) return 0;
+    }
+    if (!karatsubaChecked(sa, sb, k, z1, rest)) return 0;
+    for (int i = 0; i < 2 * h - 1; i++){
+        if (__builtin_sub_overflow(z1[i], r[i], &z1[i])) return 0;
+    }
+    for (int i = 0; i < 2 * k - 1; i++){
+        if (__builtin_sub_overflow(z1[i], r[2 * h + i], &z1[i])) return 0;
+    }
+    for (int i = 0; i < 2 * k - 1; i++){
+        if (__builtin_add_overflow(r[h + i], z1[i], &r[h + i])) return 0;
+    }
+    return 1;
+}
+
+/* Unbalanced operands are cut into pieces as long as the shorter one; r must be zeroed.
+   Returns 1, 0 when out of memory, or -1 when a checked step overflowed */
+int mulKaratsuba(const word* a, int na, const word* b, int nb, word* r, int checked){
+    if (na < nb){
+        const word* t = a; a = b; b = t;
+        int n = na; na = nb; nb = n;
+    }
+    word* piece = calloc(nb, sizeof(word));
+    word* product = malloc((2 * nb - 1) * sizeof(word));
+    word* scratch = malloc((4 * (size_t)nb + 256) * sizeof(word));
+    int ok = piece != NULL && product != NULL && scratch != NULL, fits = 1;
+    for (int s = 0; ok && fits && s < na; s += nb){
+        int len = na - s < nb ? na - s : nb;
+        memcpy(piece, a + s, len * sizeof(word));
+        if (len < nb) memset(piece + len, 0, (nb - len) * sizeof(word));
+        int used = len + nb - 1;
+        if (checked){
+            fits = karatsubaChecked((const long long*)piece, (const long long*)b, nb, (long long*)product, (long long*)scratch);
+            for (int i = 0; fits && i < used; i++){
+                fits = !__builtin_add_overflow((long long)r[s + i], (long long)product[i], (long long*)&r[s + i]);
+            }
+        } else {
+            karatsuba(piece, b, nb, product, scratch);
+            for (int i = 0; i < used; i++) r[s + i] += product[i];
+        }
+    }
+    free(piece);
+    free(product);
+    free(scratch);
+    return !ok ? 0 : fits ? 1 : -1;
+}
+
+/* NTT-friendly primes p = c * 2^k + 1, all with primitive root 3; their product is about 2^86 */
+#define NTT_PRIMES 3
+#define NTT_MAX_LOG 23
+const unsigned nttPrimes[NTT_PRIMES] = {998244353u, 167772161u, 469762049u};
+
+unsigned powMod(unsigned long long base, unsigned long long e, unsigned p){
+    unsigned long long result = 1;
+    base %= p;
+    while (e > 0){
+        if (e & 1) result = result * base % p;
+        base = base * base % p;
+        e >>= 1;
+    }
+    return (unsigned)result;
+}
+
+/* x * w mod p with wq = floor(w * 2^32 / p) precomputed (Shoup), avoiding a division per butterfly */
+unsigned mulShoup(unsigned x, unsigned w, unsigned wq, unsigned p){
+    unsigned q = (unsigned)(((unsigned long long)x * wq) >> 32);
+    unsigned r = x * w - q * p;
+    return r >= p ? r - p : r;
+}
+
+/* Twiddle tables for every level: entries [half, 2 * half) hold the powers of a primitive (2 * half)-th root */
+void prepareRoots(int n, unsigned p, unsigned* roots, unsigned* rootsQ){
+    for (int half = 1; half < n; half <<= 1){
+        unsigned w = powMod(3, (p - 1) / (2 * half), p);
+        roots[half] = 1;
+        for (int j = 1; j < half; j++) roots[half + j] = (unsigned long long)roots[half + j - 1] * w % p;
+    }
+    for (int i = 1; i < n; i++) rootsQ[i] = (unsigned)(((unsigned long long)roots[i] << 32) / p);
+}
+
+/* In-place iterative forward transform of length n (a power of two) modulo p */
+void ntt(unsigned* a, int n, unsigned p, const unsigned* roots, const unsigned* rootsQ){
+    for (int i = 1, j = 0; i < n; i++){
+        int bit = n >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j){
+            unsigned t = a[i]; a[i] = a[j]; a[j] = t;
+        }
+    }
+    for (int half = 1; half < n; half <<= 1){
+        for (int i = 0; i < n; i += 2 * half){
+            for (int j = 0; j < half; j++){
+                unsigned u = a[i + j];
+                unsigned v = mulShoup(a[i + j + half], roots[half + j], rootsQ[half + j], p);
+                a[i + j] = u + v >= p ? u + v - p : u + v;
+                a[i + j + half] = u >= v ? u - v : u + p - v;
+            }
+        }
+    }
+}
+
+/* The inverse transform is the forward one with the outputs 1..n-1 reversed, scaled by 1/n */
+void inverseNtt(unsigned* a, int n, unsigned p, const unsigned* roots, const unsigned* rootsQ){
+    ntt(a, n, p, roots, rootsQ);
+    for (int i = 1, j = n - 1; i < j; i++, j--){
+        unsigned t = a[i]; a[i] = a[j]; a[j] = t;
+    }
+    unsigned nInv = powMod(n, p - 2, p);
+    for (int i = 0; i < n; i++) a[i] = (unsigned long long)a[i] * nInv % p;
+}
+
+int bitLength(unsigned long long x){
+    return x == 0 ? 0 : 64 - __builtin_clzll(x);
+}
+
+unsigned long long maxMagnitude(const word* a, int n){
+    unsigned long long m = 0;
+    for (int i = 0; i < n; i++){
+        unsigned long long v = (long long)a[i] < 0 ? 0 - a[i] : a[i];
+        if (v > m) m = v;
+    }
+    return m;
+}
+
+/* Bits needed by any product coefficient (and any schoolbook partial sum) in the worst case */
+int productBits(const word* a, int na, const word* b, int nb){
+    int shorter = na < nb ? na : nb;
+    return bitLength(maxMagnitude(a, na)) + bitLength(maxMagnitude(b, nb)) + bitLength(shorter);
+}
+
+/* The three-prime CRT recovers a coefficient exactly when |c| < 2^85, half the modulus */
+int nttApplies(const word* a, int na, const word* b, int nb){
+    if (na + nb - 1 > (1 << NTT_MAX_LOG)) return 0;
+    return productBits(a, na, b, nb) <= 85;
+}
+
+unsigned reduce(word x, unsigned p){
+    long long v = (long long)x % p;
+    return v < 0 ? (unsigned)(v + p) : (unsigned)v;
+}
+
+/* Convolution modulo each prime, then Garner's CRT back to signed 64-bit; r must be zeroed.
+   nttApplies() keeps every coefficient below 2^85, so the CRT value is exact and can be range
+   checked. Returns 1, 0 when out of memory, or -1 when a coefficient does not fit in 64 bits */
+int mulNTT(const word* a, int na, const word* b, int nb, word* r){
+    int used = na + nb - 1, n = 1;
+    while (n < used) n <<= 1;
+    unsigned* fa = malloc(n * sizeof(unsigned));
+    unsigned* fb = malloc(n * sizeof(unsigned));
+    unsigned* roots = malloc(n * sizeof(unsigned));
+    unsigned* rootsQ = malloc(n * sizeof(unsigned));
+    unsigned* residues = malloc((size_t)NTT_PRIMES * used * sizeof(unsigned));
+    int ok = fa != NULL && fb != NULL && roots != NULL && rootsQ != NULL && residues != NULL, fits = 1;
+
+    for (int k = 0; ok && k < NTT_PRIMES; k++){
+        unsigned p = nttPrimes[k];
+        for (int i = 0; i < n; i++){
+            fa[i] = i < na ? reduce(a[i], p) : 0;
+            fb[i] = i < nb ? reduce(b[i], p) : 0;
+        }
+        prepareRoots(n, p, roots, rootsQ);
+        ntt(fa, n, p, roots, rootsQ);
+        ntt(fb, n, p, roots, rootsQ);
+        for (int i = 0; i < n; i++) fa[i] = (unsigned long long)fa[i] * fb[i] % p;
+        inverseNtt(fa, n, p, roots, rootsQ);
+        memcpy(residues + (size_t)k * used, fa, used * sizeof(unsigned));
+    }
+
+    if (ok){
+        const unsigned long long p0 = nttPrimes[0], p1 = nttPrimes[1], p2 = nttPrimes[2];
+        const unsigned long long inv01 = powMod(p0, p1 - 2, p1);
+        const unsigned long long inv012 = powMod(p0 * p1 % p2, p2 - 2, p2);
+        const unsigned __int128 modulus = (unsigned __int128)p0 * p1 * p2;
+        for (int i = 0; fits && i < used; i++){
+            unsigned long long r0 = residues[i], r1 = residues[used + i], r2 = residues[2 * (size_t)used + i];
+            unsigned long long x1 = (r1 + p1 - r0 % p1) % p1 * inv01 % p1;
+            unsigned long long partial = (r0 + x1 * p0) % p2;
+            unsigned long long x2 = (r2 + p2 - partial) % p2 * inv012 % p2;
+            unsigned __int128 value = r0 + (unsigned __int128)x1 * p0 + (unsigned __int128)x2 * p0 * p1;
+            __int128 c = value > modulus / 2 ? -(__int128)(modulus - value) : (__int128)value;
+            fits = c >= LLONG_MIN && c <= LLONG_MAX;
+            r[i] = (word)c;
+        }
+    }
+    free(fa);
+    free(fb);
+    free(roots);
+    free(rootsQ);
+    free(residues);
+    return !ok ? 0 : fits ? 1 : -1;
+}
+
+/* Picks the method from the shorter operand length; r must be zeroed. When productBits() allows
+   a coefficient past 63 bits, checked Karatsuba runs first and mulExact() settles any overflow it
+   reports. Returns 1, 0 when out of memory, or -1 when a product coefficient does not fit */
+int mulDense(const word* a, int na, const word* b, int nb, word* r){
+    int shorter = na < nb ? na : nb;
+    int wraps = productBits(a, na, b, nb) > 63;
+    if (shorter >= nttCutoff && nttApplies(a, na, b, nb)) return mulNTT(a, na, b, nb, r);
+    if (!wraps && shorter < karatsubaCutoff){
+        mulSchoolbook(a, na, b, nb, r);
+        return 1;
+    }
+    if (!wraps) return mulKaratsuba(a, na, b, nb, r, 0);
+    if (shorter >= karatsubaCutoff){
+        int status = mulKaratsuba(a, na, b, nb, r, 1);
+        if (status != -1) return status;
+    }
+    return mulExact((const long long*)a, na, (const long long*)b, nb, (long long*)r) ? 1 : -1;
+}
+
+/* Builds the dense form of p in d (a copy even if p is already dense) */
+int denseCopy(struct Poly* p, struct Poly* d){
+    if (!allocPoly(d, 1, degree(p) + 1)) return 0;
+    d->count = d->capacity;
+    if (p->dense) memcpy(d->coeffs, p->coeffs, p->count * sizeof(long long));
+    else for (int i = 0; i < p->count; i++) d->coeffs[p->exps[i]] = p->coeffs[i];
+    return 1;
+}
+
+struct HeapItem{
+    int exp;
+    int i;      /* term of a */
+    int j;      /* term of b it is currently paired with */
+};
+
+void siftDown(struct HeapItem* heap, int size, int pos){
+    struct HeapItem item = heap[pos];
+    while (2 * pos + 1 < size){
+        int child = 2 * pos + 1;
+        if (child + 1 < size && heap[child + 1].exp < heap[child].exp) child++;
+        if (heap[child].exp >= item.exp) break;
+        heap[pos] = heap[child];
+        pos = child;
+    }
+    heap[pos] = item;
+}
+
+/* Stores the finished sum for the last term of r, dropping it if zero; 0 if it does not fit */
+int closeTerm(struct Poly* r, __int128 sum){
+    if (sum == 0) r->count--;
+    else if (sum < LLONG_MIN || sum > LLONG_MAX) return 0;
+    else r->coeffs[r->count - 1] = (long long)sum;
+    return 1;
+}
+
+/* Sparse product: a heap holds one pending pair per term of a, so products come out in
+   exponent order and equal exponents are combined as they appear (Johnson's method). Each sum
+   is kept in 128 bits until its exponent is done. Returns 1, 0 when out of memory, or -1 when
+   a coefficient does not fit in 64 bits */
+int mulSparse(struct Poly* a, struct Poly* b, struct Poly* r){
+    struct HeapItem* heap = malloc(a->count * sizeof(struct HeapItem));
+    if (heap == NULL || !allocPoly(r, 0, a->count + b->count)){
+        printf("Memory allocation failed!\n");
+        free(heap);
+        return 0;
+    }
+    int size = a->count;
+    for (int i = 0; i < size; i++){
+        heap[i].exp = a->exps[i] + b->exps[0];
+        heap[i].i = i;
+        heap[i].j = 0;
+    }
+    for (int i = size / 2 - 1; i >= 0; i--) siftDown(heap, size, i);
+
+    __int128 sum = 0;
+    int fits = 1;
+    while (size > 0 && fits){
+        struct HeapItem* top = &heap[0];
+        __int128 c = (__int128)a->coeffs[top->i] * b->coeffs[top->j];
+        if (r->count > 0 && r->exps[r->count - 1] == top->exp){
+            fits = !__builtin_add_overflow(sum, c, &sum);
+        } else {
+            if (r->count > 0 && !closeTerm(r, sum)) break;
+            if (r->count == r->capacity){
+                int capacity = r->capacity * 2;
+                int* exps = realloc(r->exps, capacity * sizeof(int));
+                if (exps != NULL) r->exps = exps;
+                long long* coeffs = realloc(r->coeffs, capacity * sizeof(long long));
+                if (coeffs != NULL) r->coeffs = coeffs;
+                if (exps == NULL || coeffs == NULL){
+                    printf("Memory allocation failed!\n");
+                    free(heap);
+                    return 0;
+                }
+                r->capacity = capacity;
+            }
+            r->exps[r->count++] = top->exp;
+            sum = c;
+        }
+        if (++top->j < b->count){
+            top->exp = a->exps[top->i] + b->exps[top->j];
+        } else {
+            heap[0] = heap[--size];
+        }
+        siftDown(heap, size, 0);
+    }
+    if (size > 0 || (r->count > 0 && !closeTerm(r, sum))) fits = 0;
+    free(heap);
+    return fits ? 1 : -1;
+}
+
+/* r = a * b; r must not alias a or b. Returns 1, 0 on failure, or -1 when a coefficient of the
+   product does not fit in 64 bits (r is then left empty) */
+int multiplyPolynomials(struct Poly* a, struct Poly* b, struct Poly* r){
+    if (a->count == 0 || b->count == 0) return allocPoly(r, 0, 0);
+
+    long long span = (long long)degree(a) + degree(b) + 1;
+    long long pairs = (long long)termCount(a) * termCount(b);
+    if ((long long)degree(a) + degree(b) >= INT_MAX){
+        printf("Product degree does not fit in an int\n");
+        return 0;
+    }
+
+    /* Dense convolution touches every slot of the result; enumerating pairs touches every pair */
+    if (span <= MAX_DENSE_PRODUCT && ((a->dense && b->dense) || span <= 4 * pairs)){
+        struct Poly da, db;
+        initPoly(&da);
+        initPoly(&db);
+        int ok = denseCopy(a, &da) && denseCopy(b, &db) && allocPoly(r, 1, (int)span);
+        if (ok){
+            r->count = (int)span;
+            ok = mulDense((const word*)da.coeffs, da.count, (const word*)db.coeffs, db.count, (word*)r->coeffs);
+            if (!ok) printf("Memory allocation failed!\n");
+        }
+        freePoly(&da);
+        freePoly(&db);
+        if (ok != 1){
+            freePoly(r);
+            return ok;
+        }
+    } else {
+        struct Poly sa, sb;
+        initPoly(&sa);
+        initPoly(&sb);
+        int ok = (!a->dense || sparseCopy(a, &sa)) && (!b->dense || sparseCopy(b, &sb));
+        struct Poly* x = a->dense ? &sa : a;
+        struct Poly* y = b->dense ? &sb : b;
+        if (ok) ok = mulSparse(x->count <= y->count ? x : y, x->count <= y->count ? y : x, r);
+        freePoly(&sa);
+        freePoly(&sb);
+        if (ok != 1){
+            freePoly(r);
+            return ok;
+        }
+    }
+    normalize(r);
+    return 1;
+}
+
+int compareExp(const void* x, const void* y){
+    int a = *(const int*)x, b = *(const int*)y;
+    return (a > b) - (a < b);
+}
+
+/* Reads the terms into sparse arrays, sorts them once by exponent and combines duplicates */
+int readPolynomial(struct Poly* p){
+    int n, coeff, exp;
+    printf("Enter number of terms: ");
+    if (scanf("%d", &n) != 1 || n < 0) n = 0;
+
+    int* pairs = malloc((n > 0 ? n : 1) * 2 * sizeof(int));
+    if (pairs == NULL){
+        printf("Memory allocation failed!\n");
+        return 0;
+    }
+    for (int i = 0; i < n; i++){
+        coeff = exp = 0;
+        printf("Term %d - Coefficient: ", i + 1);
+        scanf("%d", &coeff);
+        printf("Term %d - Exponent: ", i + 1);
+        while (scanf("%d", &exp) == 1 && exp < 0){
+            printf("Exponent must be non-negative, enter again: ");
+        }
+        pairs[2 * i] = exp;
+        pairs[2 * i + 1] = coeff;
+    }
+    qsort(pairs, n, 2 * sizeof(int), compareExp);
+
+    if (!allocPoly(p, 0, n)){
+        free(pairs);
+        return 0;
+    }
+    for (int i = 0; i < n; i++){
+        if (p->count > 0 && p->exps[p->count - 1] == pairs[2 * i]){
+            p->coeffs[p->count - 1] += pairs[2 * i + 1];
+            if (p->coeffs[p->count - 1] == 0) p->count--;
+        } else if (pairs[2 * i + 1] != 0){
+            p->exps[p->count] = pairs[2 * i];
+            p->coeffs[p->count++] = pairs[2 * i + 1];
+        }
+    }
+    free(pairs);
+    normalize(p);
+    return 1;
+}
+
+void printTerm(long long coeff, int exp, int first){
+    if (coeff < 0) printf(first ? "-" : " - ");
+    else if (!first) printf(" + ");
+
+    long long c = llabs(coeff);
+    if (exp == 0) printf("%lld", c);
+    else if (c != 1) printf(exp == 1 ? "%lldx" : "%lldx^%d", c, exp);
+    else if (exp == 1) printf("x");
+    else printf("x^%d", exp);
+}
+
+/* Prints terms from the highest exponent down, like the linked-list version */
+void display(struct Poly* p){
+    int first = 1;
+    for (int i = p->count - 1; i >= 0; i--){
+        long long c = p->coeffs[i];
+        if (c == 0) continue;
+        printTerm(c, p->dense ? i : p->exps[i], first);
+        first = 0;
+    }
+    if (first) printf("0");
+    printf("\n");
+}
+
+void describe(struct Poly* p){
+    int terms = termCount(p);
+    printf("   [%s, %d terms, degree %d, %zu bytes; linked list would use %zu]\n",
+           p->dense ? "dense" : "sparse", terms, degree(p), polyBytes(p),
+           (size_t)terms * (2 * sizeof(int) + sizeof(void*)));
+}
+
+double seconds(){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Seconds per product of two length-n operands; method 0 schoolbook, 1 Karatsuba, 2 NTT */
+double timeProduct(int method, const word* a, const word* b, int n, word* r){
+    int rounds = 0;
+    double start = seconds(), elapsed;
+    do {
+        memset(r, 0, (2 * n - 1) * sizeof(word));
+        if (method == 0) mulSchoolbook(a, n, b, n, r);
+        else if (method == 1) mulKaratsuba(a, n, b, n, r, 0);
+        else mulNTT(a, n, b, n, r);
+        rounds++;
+        elapsed = seconds() - start;
+    } while (elapsed < 0.05);
+    return elapsed / rounds;
+}
+
+/* Finds the size where one Karatsuba split starts beating schoolbook, then where NTT
+   starts beating the tuned Karatsuba, and prints the matching build flags */
+void benchmark(){
+    const int maxN = 1 << 16;
+    word* a = malloc(maxN * sizeof(word));
+    word* b = malloc(maxN * sizeof(word));
+    word* r = malloc(2 * maxN * sizeof(word));
+    word* check = malloc(2 * maxN * sizeof(word));
+    if (a == NULL || b == NULL || r == NULL || check == NULL){
+        printf("Memory allocation failed!\n");
+        return;
+    }
+    srand(12345);
+    for (int i = 0; i < maxN; i++){
+        a[i] = (word)(rand() % 2001 - 1000);
+        b[i] = (word)(rand() % 2001 - 1000);
+    }
+
+    int karatsubaAt = 0, nttAt = 0, mismatches = 0;
+    printf("%8s %16s %16s\n", "n", "schoolbook (us)", "1-level Kar. (us)");
+    for (int n = 4; n <= 1024; n *= 2){
+        double school = timeProduct(0, a, b, n, check);
+        karatsubaCutoff = n / 2 + 1;
+        double kara = timeProduct(1, a, b, n, r);
+        mismatches += memcmp(r, check, (2 * n - 1) * sizeof(word)) != 0;
+        printf("%8d %16.2f %16.2f\n", n, school * 1e6, kara * 1e6);
+        if (karatsubaAt == 0 && kara < school) karatsubaAt = n;
+    }
+    karatsubaCutoff = karatsubaAt ? karatsubaAt : KARATSUBA_THRESHOLD;
+
+    printf("\n%8s %16s %16s\n", "n", "Karatsuba (us)", "NTT (us)");
+    for (int n = 64; n <= maxN; n *= 2){
+        double kara = timeProduct(1, a, b, n, check);
+        double fast = timeProduct(2, a, b, n, r);
+        mismatches += memcmp(r, check, (2 * n - 1) * sizeof(word)) != 0;
+        printf("%8d %16.2f %16.2f\n", n, kara * 1e6, fast * 1e6);
+        if (nttAt == 0 && fast < kara) nttAt = n;
+    }
+
+    printf("\nResults %s across methods\n", mismatches ? "DIFFER" : "agree");
+    printf("Suggested build flags: -DKARATSUBA_THRESHOLD=%d -DNTT_THRESHOLD=%d\n",
+           karatsubaCutoff, nttAt ? nttAt : maxN);
+    free(a);
+    free(b);
+    free(r);
+    free(check);
+}
+
+int main(int argc, char* argv[]){
+    if (argc > 1 && strcmp(argv[1], "bench") == 0){
+        benchmark();
+        return 0;
+    }
+
+    struct Poly p1, p2, result, product;
+    initPoly(&p1);
+    initPoly(&p2);
+    initPoly(&result);
+    initPoly(&product);
+
+    printf("\nFirst Polynomial:\n");
+    if (!readPolynomial(&p1)) return 1;
+
+    printf("\nSecond Polynomial:\n");
+    if (!readPolynomial(&p2)) return 1;
+
+    printf("\nPolynomial 1: ");
+    display(&p1);
+    describe(&p1);
+
+    printf("Polynomial 2: ");
+    display(&p2);
+    describe(&p2);
+
+    if (addPolynomials(&p1, &p2, &result)){
+        printf("\nSum: ");
+        display(&result);
+        describe(&result);
+    }
+
+    int status = multiplyPolynomials(&p1, &p2, &product);
+    if (status == 1){
+        printf("\nProduct: ");
+        display(&product);
+        describe(&product);
+    } else if (status == -1){
+        printf("\nProduct: a coefficient does not fit in 64 bits\n");
+    }
+
+    freePoly(&p1);
+    freePoly(&p2);
+    freePoly(&result);
+    freePoly(&product);
+
+    return 0;
+}
@@ -1,10 +1,21 @@
 /*
 ASSIGNMENT 8:
 Problem Statement: Write a program in C to add two polynomials using linked list.
+
+Build: gcc -O3 -pthread polynomial_addition.c -o polynomial_addition
 */
 
 #include<stdio.h>
 #include<stdlib.h>
+#include<string.h>
+#include<pthread.h>
+#include<unistd.h>
+#include<time.h>
+
+/* Points evaluated side by side in one Horner pass */
+#define EVAL_LANES 8
+/* Fewest points worth giving to one thread */
+#define EVAL_THREAD_MIN 65536
 
 struct Node{
     int coeff;
@@ -50,6 +61,83 @@ struct Node* insertTerm(struct Node* head, int coeff, int exp){
     return head;
 }
 
+/* Links a new term at *tail and returns the link for the next one; terms must arrive in decreasing exponent order */
+struct Node** appendTerm(struct Node** tail, int coeff, int exp){
+    if (coeff == 0) return tail;
+    
+    struct Node* newNode = createNode(coeff, exp);
+    *tail = newNode;
+    return &newNode->next;
+}
+
+/* One (coeff, exp) pair as read; also the record layout of binary input files */
+struct Term{
+    int coeff;
+    int exp;
+};
+
+/* Stable LSD radix sort on exponent, largest first, one byte per pass; returns the buffer holding the result */
+struct Term* sortTerms(struct Term* terms, struct Term* scratch, int n){
+    static int count[4][256];
+    for (int d = 0; d < 4; d++){
+        for (int b = 0; b < 256; b++) count[d][b] = 0;
+    }
+    for (int i = 0; i < n; i++){
+        unsigned key = (unsigned)terms[i].exp ^ 0x7fffffffu;
+        count[0][key & 0xff]++;
+        count[1][(key >> 8) & 0xff]++;
+        count[2][(key >> 16) & 0xff]++;
+        count[3][key >> 24]++;
+    }
+
+    for (int d = 0; d < 4; d++){
+        int shift = 8 * d;
+        /* A byte shared by every key leaves the order unchanged */
+        if (count[d][(((unsigned)terms[0].exp ^ 0x7fffffffu) >> shift) & 0xff] == n) continue;
+
+        int offset = 0;
+        for (int b = 0; b < 256; b++){
+            int c = count[d][b];
+            count[d][b] = offset;
+            offset += c;
+        }
+        for (int i = 0; i < n; i++){
+            scratch[count[d][(((unsigned)terms[i].exp ^ 0x7fffffffu) >> shift) & 0xff]++] = terms[i];
+        }
+        struct Term* temp = terms;
+        terms = scratch;
+        scratch = temp;
+    }
+    return terms;
+}
+
+/* Sorts the terms once, combines equal exponents and links the list in one pass; terms is overwritten */
+struct Node* buildPolynomial(struct Term* terms, int n){
+    struct Node* head = NULL;
+    if (n <= 0) return head;
+
+    struct Term* scratch = malloc(n * sizeof(struct Term));
+    if (scratch == NULL){
+        for (int i = 0; i < n; i++){
+            head = insertTerm(head, terms[i].coeff, terms[i].exp);
+        }
+        return head;
+    }
+
+    struct Term* sorted = sortTerms(terms, scratch, n);
+    struct Node** tail = &head;
+    for (int i = 0; i < n; ){
+        int exp = sorted[i].exp, coeff = 0;
+        while (i < n && sorted[i].exp == exp){
+            coeff += sorted[i++].coeff;
+        }
+        tail = appendTerm(tail, coeff, exp);
+    }
+
+    free(scratch);
+    return head;
+}
+
 void display(struct Node* head){
     if (head == NULL){
         printf("0\n");
@@ -78,52 +166,374 @@ void display(struct Node* head){
     printf("\n");
 }
 
+/* Merges two sorted polynomials by appending at the tail, O(n + m) */
 struct Node* addPolynomials(struct Node* p1, struct Node* p2){
     struct Node* result = NULL;
+    struct Node** tail = &result;
     
     while (p1 != NULL && p2 != NULL){
         if (p1->exp > p2->exp){
-            result = insertTerm(result, p1->coeff, p1->exp);
+            tail = appendTerm(tail, p1->coeff, p1->exp);
             p1 = p1->next;
         } else if (p1->exp < p2->exp){
-            result = insertTerm(result, p2->coeff, p2->exp);
+            tail = appendTerm(tail, p2->coeff, p2->exp);
             p2 = p2->next;
         } else {
-            int sum = p1->coeff + p2->coeff;
-            if (sum != 0) result = insertTerm(result, sum, p1->exp);
+            tail = appendTerm(tail, p1->coeff + p2->coeff, p1->exp);
             p1 = p1->next;
             p2 = p2->next;
         }
     }
     
     while (p1 != NULL){
-        result = insertTerm(result, p1->coeff, p1->exp);
+        tail = appendTerm(tail, p1->coeff, p1->exp);
         p1 = p1->next;
     }
     
     while (p2 != NULL){
-        result = insertTerm(result, p2->coeff, p2->exp);
+        tail = appendTerm(tail, p2->coeff, p2->exp);
         p2 = p2->next;
     }
     
     return result;
 }
 
+/* p1 += p2 without allocating: p2's nodes are spliced into p1 or freed when exponents match.
+   p2 is consumed; returns the new head of p1. */
+struct Node* accumulatePolynomial(struct Node* p1, struct Node* p2){
+    struct Node** link = &p1;
+    
+    while (p2 != NULL){
+        struct Node* cur = *link;
+        if (cur == NULL){
+            *link = p2;
+            break;
+        }
+        
+        if (cur->exp > p2->exp){
+            link = &cur->next;
+        } else if (cur->exp < p2->exp){
+            struct Node* next = p2->next;
+            p2->next = cur;
+            *link = p2;
+            link = &p2->next;
+            p2 = next;
+        } else {
+            struct Node* used = p2;
+            cur->coeff += p2->coeff;
+            p2 = p2->next;
+            free(used);
+            if (cur->coeff == 0){
+                *link = cur->next;
+                free(cur);
+            } else {
+                link = &cur->next;
+            }
+        }
+    }
+    
+    return p1;
+}
+
+/* Restores the heap below pos; the term with the highest exponent stays on top */
+void siftDown(struct Node** heap, int size, int pos){
+    struct Node* item = heap[pos];
+    while (2 * pos + 1 < size){
+        int child = 2 * pos + 1;
+        if (child + 1 < size && heap[child + 1]->exp > heap[child]->exp) child++;
+        if (heap[child]->exp <= item->exp) break;
+        heap[pos] = heap[child];
+        pos = child;
+    }
+    heap[pos] = item;
+}
+
+/* Sums K polynomials in one k-way merge: a heap holds the next unread term of every input,
+   equal exponents are added up as they surface and zero sums are never stored.
+   O(N log K) for N input terms; the inputs are left untouched. */
+struct Node* sumPolynomials(struct Node* list[], int K){
+    struct Node* result = NULL;
+    struct Node** tail = &result;
+    struct Node** heap = malloc((K > 0 ? K : 1) * sizeof(struct Node*));
+    if (heap == NULL){
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+    
+    int size = 0;
+    for (int i = 0; i < K; i++){
+        if (list[i] != NULL) heap[size++] = list[i];
+    }
+    for (int i = size / 2 - 1; i >= 0; i--){
+        siftDown(heap, size, i);
+    }
+    
+    while (size > 0){
+        int exp = heap[0]->exp;
+        int sum = 0;
+        while (size > 0 && heap[0]->exp == exp){
+            sum += heap[0]->coeff;
+            heap[0] = heap[0]->next;
+            if (heap[0] == NULL) heap[0] = heap[--size];
+            if (size > 0) siftDown(heap, size, 0);
+        }
+        tail = appendTerm(tail, sum, exp);
+    }
+    
+    free(heap);
+    return result;
+}
+
+/* Term arrays flattened from a list (exponents decreasing) for batch evaluation */
+struct Terms{
+    int n;
+    int* exps;
+    long long* coeffs;
+};
+
+int flattenTerms(struct Node* head, struct Terms* t){
+    t->n = 0;
+    for (struct Node* p = head; p != NULL; p = p->next){
+        if (p->coeff != 0) t->n++;
+    }
+    t->exps = malloc((t->n > 0 ? t->n : 1) * sizeof(int));
+    t->coeffs = malloc((t->n > 0 ? t->n : 1) * sizeof(long long));
+    if (t->exps == NULL || t->coeffs == NULL){
+        free(t->exps);
+        free(t->coeffs);
+        return 0;
+    }
+    int i = 0;
+    for (struct Node* p = head; p != NULL; p = p->next){
+        if (p->coeff != 0){
+            t->exps[i] = p->exp;
+            t->coeffs[i++] = p->coeff;
+        }
+    }
+    return 1;
+}
+
+/* Exponent step after term i in the Horner scheme: the gap to the next term, or the last exponent.
+   Both loaders reject negative exponents, so every step is non-negative. */
+int termGap(const struct Terms* t, int i){
+    return i + 1 < t->n ? t->exps[i] - t->exps[i + 1] : t->exps[i];
+}
+
+/* Horner over EVAL_LANES points at once. Every step does the same work in each lane, so the
+   lane loops vectorize; a gap of more than one exponent is crossed by squaring x in all lanes. */
+void evalBlock(const struct Terms* t, const double* x, double* y, int count){
+    double acc[EVAL_LANES], xs[EVAL_LANES], pw[EVAL_LANES];
+    for (int l = 0; l < EVAL_LANES; l++){
+        acc[l] = 0;
+        xs[l] = l < count ? x[l] : 0;
+    }
+    for (int i = 0; i < t->n; i++){
+        double c = (double)t->coeffs[i];
+        int gap = termGap(t, i);
+        for (int l = 0; l < EVAL_LANES; l++) acc[l] += c;
+        if (gap == 1){
+            for (int l = 0; l < EVAL_LANES; l++) acc[l] *= xs[l];
+        } else if (gap > 1){
+            for (int l = 0; l < EVAL_LANES; l++) pw[l] = xs[l];
+            for (; gap > 0; gap >>= 1){
+                if (gap & 1){
+                    for (int l = 0; l < EVAL_LANES; l++) acc[l] *= pw[l];
+                }
+                for (int l = 0; l < EVAL_LANES; l++) pw[l] *= pw[l];
+            }
+        }
+    }
+    for (int l = 0; l < count; l++) y[l] = acc[l];
+}
+
+unsigned long long mulMod(unsigned long long a, unsigned long long b, unsigned long long m){
+    return (unsigned long long)((unsigned __int128)a * b % m);
+}
+
+/* Same scheme modulo m; values stay below m, so m up to 2^63 is safe */
+void evalBlockMod(const struct Terms* t, const unsigned long long* x, unsigned long long* y, int count,
+                  unsigned long long m){
+    unsigned long long acc[EVAL_LANES], xs[EVAL_LANES], pw[EVAL_LANES];
+    for (int l = 0; l < EVAL_LANES; l++){
+        acc[l] = 0;
+        xs[l] = l < count ? x[l] % m : 0;
+    }
+    for (int i = 0; i < t->n; i++){
+        long long r = t->coeffs[i] % (long long)m;
+        unsigned long long c = r < 0 ? (unsigned long long)(r + (long long)m) : (unsigned long long)r;
+        int gap = termGap(t, i);
+        for (int l = 0; l < EVAL_LANES; l++){
+            acc[l] += c;
+            if (acc[l] >= m) acc[l] -= m;
+        }
+        if (gap == 1){
+            for (int l = 0; l < EVAL_LANES; l++) acc[l] = mulMod(acc[l], xs[l], m);
+        } else if (gap > 1){
+            for (int l = 0; l < EVAL_LANES; l++) pw[l] = xs[l];
+            for (; gap > 0; gap >>= 1){
+                if (gap & 1){
+                    for (int l = 0; l < EVAL_LANES; l++) acc[l] = mulMod(acc[l], pw[l], m);
+                }
+                for (int l = 0; l < EVAL_LANES; l++) pw[l] = mulMod(pw[l], pw[l], m);
+            }
+        }
+    }
+    for (int l = 0; l < count; l++) y[l] = acc[l];
+}
+
+struct EvalJob{
+    const struct Terms* terms;
+    const void* x;
+    void* y;
+    int begin;
+    int end;
+    unsigned long long modulus;     /* 0: floating point */
+};
+
+void* evalRange(void* arg){
+    struct EvalJob* job = arg;
+    for (int i = job->begin; i < job->end; i += EVAL_LANES){
+        int count = job->end - i < EVAL_LANES ? job->end - i : EVAL_LANES;
+        if (job->modulus == 0){
+            evalBlock(job->terms, (const double*)job->x + i, (double*)job->y + i, count);
+        } else {
+            evalBlockMod(job->terms, (const unsigned long long*)job->x + i,
+                         (unsigned long long*)job->y + i, count, job->modulus);
+        }
+    }
+    return NULL;
+}
+
+/* Evaluates at n points (doubles, or integers modulo a non-zero modulus); large sets are split
+   across threads. Returns the number of threads used, 0 on failure. */
+int evaluatePoints(struct Node* head, const void* x, void* y, int n, unsigned long long modulus){
+    struct Terms terms;
+    if (!flattenTerms(head, &terms)) return 0;
+
+    int threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads > n / EVAL_THREAD_MIN) threads = n / EVAL_THREAD_MIN;
+    if (threads < 1) threads = 1;
+
+    struct EvalJob* jobs = malloc(threads * sizeof(struct EvalJob));
+    pthread_t* tids = malloc(threads * sizeof(pthread_t));
+    if (jobs == NULL || tids == NULL){
+        free(jobs);
+        free(tids);
+        free(terms.exps);
+        free(terms.coeffs);
+        return 0;
+    }
+
+    /* Ranges start on lane boundaries so no block straddles two threads */
+    int per = (n / threads + EVAL_LANES - 1) / EVAL_LANES * EVAL_LANES;
+    for (int i = 0; i < threads; i++){
+        jobs[i].terms = &terms;
+        jobs[i].x = x;
+        jobs[i].y = y;
+        jobs[i].begin = i * per < n ? i * per : n;
+        jobs[i].end = i == threads - 1 || (i + 1) * per > n ? n : (i + 1) * per;
+        jobs[i].modulus = modulus;
+    }
+    /* The calling thread takes the first range, and any range whose thread fails to start */
+    int spawned = 1;
+    while (spawned < threads && pthread_create(&tids[spawned], NULL, evalRange, &jobs[spawned]) == 0){
+        spawned++;
+    }
+    for (int i = spawned; i < threads; i++){
+        evalRange(&jobs[i]);
+    }
+    evalRange(&jobs[0]);
+    for (int i = 1; i < spawned; i++){
+        pthread_join(tids[i], NULL);
+    }
+
+    free(jobs);
+    free(tids);
+    free(terms.exps);
+    free(terms.coeffs);
+    return threads;
+}
+
+double seconds(){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Reads points and prints the polynomial's value at each of them */
+void evaluateMenu(struct Node* head){
+    int n = 0;
+    long long modulus = 0;
+    printf("\nNumber of points to evaluate the sum at (0 to skip): ");
+    if (scanf("%d", &n) != 1 || n <= 0) return;
+    printf("Modulus (0 for floating point): ");
+    if (scanf("%lld", &modulus) != 1 || modulus < 0) modulus = 0;
+
+    size_t size = modulus ? sizeof(unsigned long long) : sizeof(double);
+    void* x = malloc(n * size);
+    void* y = malloc(n * size);
+    if (x == NULL || y == NULL){
+        printf("Memory allocation failed!\n");
+        free(x);
+        free(y);
+        return;
+    }
+
+    printf("Enter %d points: ", n);
+    for (int i = 0; i < n; i++){
+        if (modulus){
+            long long v = 0;
+            scanf("%lld", &v);
+            v %= modulus;
+            ((unsigned long long*)x)[i] = v < 0 ? v + modulus : v;
+        } else {
+            ((double*)x)[i] = 0;
+            scanf("%lf", (double*)x + i);
+        }
+    }
+
+    double start = seconds();
+    int threads = evaluatePoints(head, x, y, n, modulus);
+    double elapsed = seconds() - start;
+    if (threads == 0){
+        printf("Memory allocation failed!\n");
+    } else {
+        for (int i = 0; i < n; i++){
+            if (modulus) printf("P(%llu) = %llu (mod %lld)\n", ((unsigned long long*)x)[i], ((unsigned long long*)y)[i], modulus);
+            else printf("P(%g) = %.10g\n", ((double*)x)[i], ((double*)y)[i]);
+        }
+        fprintf(stderr, "Evaluated %d points in %.6f s with %d thread%s\n", n, elapsed, threads, threads > 1 ? "s" : "");
+    }
+    free(x);
+    free(y);
+}
+
 struct Node* readPolynomial(){
     struct Node* head = NULL;
-    int n, coeff, exp;
-    
+    int n = 0;
+
     printf("Enter number of terms: ");
     scanf("%d", &n);
-    
+    if (n <= 0) return head;
+
+    struct Term* terms = malloc(n * sizeof(struct Term));
+    if (terms == NULL){
+        printf("Memory allocation failed!\n");
+        return head;
+    }
+
     for (int i = 0; i < n; i++){
+        terms[i].coeff = terms[i].exp = 0;
         printf("Term %d - Coefficient: ", i + 1);
-        scanf("%d", &coeff);
+        scanf("%d", &terms[i].coeff);
         printf("Term %d - Exponent: ", i + 1);
-        scanf("%d", &exp);
-        head = insertTerm(head, coeff, exp);
+        while (scanf("%d", &terms[i].exp) == 1 && terms[i].exp < 0){
+            printf("Exponent must be non-negative, enter again: ");
+        }
     }
-    
+
+    head = buildPolynomial(terms, n);
+    free(terms);
     return head;
 }
 
@@ -136,8 +546,168 @@ void freePoly(struct Node* head){
     }
 }
 
-int main(){
+/* "./polynomial_addition K" reads K polynomials and prints their sum */
+int sumMode(int K){
+    struct Node** list = calloc(K, sizeof(struct Node*));
+    if (list == NULL){
+        printf("Memory allocation failed!\n");
+        return 1;
+    }
+    
+    for (int i = 0; i < K; i++){
+        printf("\nPolynomial %d:\n", i + 1);
+        list[i] = readPolynomial();
+    }
+    
+    struct Node* result = sumPolynomials(list, K);
+    printf("\nSum of %d polynomials: ", K);
+    display(result);
+    
+    for (int i = 0; i < K; i++){
+        freePoly(list[i]);
+    }
+    freePoly(result);
+    free(list);
+    return 0;
+}
+
+/* Reads the next integer from a text buffer: 1 on success, 0 at end of input, -1 on bad input */
+int parseInt(const char** pos, const char* end, int* value){
+    const char* p = *pos;
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')) p++;
+    *pos = p;
+    if (p == end) return 0;
+
+    int negative = 0;
+    if (*p == '-' || *p == '+') negative = *p++ == '-';
+    if (p == end || *p < '0' || *p > '9') return -1;
+
+    long long v = 0;
+    while (p < end && *p >= '0' && *p <= '9'){
+        v = v * 10 + (*p++ - '0');
+        if (v > 2147483648LL) return -1;
+    }
+    if (negative) v = -v;
+    if (v > 2147483647LL) return -1;
+    *value = (int)v;
+    *pos = p;
+    return 1;
+}
+
+/*
+Loads a whole polynomial file at once. Text files hold whitespace-separated "coeff exp" pairs;
+binary files hold struct Term records (two 32-bit ints in host byte order). Returns 0 on error,
+including any negative exponent.
+*/
+int loadPolynomial(const char* path, int binary, struct Node** head){
+    double start = seconds();
+    FILE* file = fopen(path, "rb");
+    if (file == NULL){
+        printf("Cannot open %s\n", path);
+        return 0;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    rewind(file);
+    char* data = size >= 0 ? malloc(size + 1) : NULL;
+    if (data == NULL || fread(data, 1, size, file) != (size_t)size){
+        printf("Cannot read %s\n", path);
+        free(data);
+        fclose(file);
+        return 0;
+    }
+    fclose(file);
+
+    struct Term* terms;
+    int n = 0;
+    if (binary){
+        if (size % sizeof(struct Term) != 0 || size / sizeof(struct Term) > 2147483647){
+            printf("%s is not a file of (coeff, exp) int pairs\n", path);
+            free(data);
+            return 0;
+        }
+        terms = (struct Term*)data;
+        n = size / sizeof(struct Term);
+    } else {
+        /* k pairs take at least 4k - 1 characters */
+        terms = malloc(((size + 1) / 4 + 1) * sizeof(struct Term));
+        if (terms == NULL){
+            printf("Memory allocation failed!\n");
+            free(data);
+            return 0;
+        }
+        const char* pos = data;
+        const char* end = data + size;
+        int status;
+        while ((status = parseInt(&pos, end, &terms[n].coeff)) == 1){
+            if (parseInt(&pos, end, &terms[n].exp) != 1){
+                status = -1;
+                break;
+            }
+            n++;
+        }
+        if (status != 0){
+            printf("Bad input in %s after %d terms\n", path, n);
+            free(terms);
+            free(data);
+            return 0;
+        }
+        free(data);
+        data = (char*)terms;
+    }
+
+    for (int i = 0; i < n; i++){
+        if (terms[i].exp < 0){
+            printf("Negative exponent %d in %s (term %d)\n", terms[i].exp, path, i + 1);
+            free(data);
+            return 0;
+        }
+    }
+
+    *head = buildPolynomial(terms, n);
+    free(data);
+    fprintf(stderr, "Loaded %d terms from %s in %.3f ms\n", n, path, (seconds() - start) * 1e3);
+    return 1;
+}
+
+/* "./polynomial_addition -t a.txt b.txt" (or -b for binary files) adds two polynomials loaded from files */
+int fileMode(int binary, const char* path1, const char* path2){
+    struct Node *p1 = NULL, *p2 = NULL;
+    if (!loadPolynomial(path1, binary, &p1)) return 1;
+    if (!loadPolynomial(path2, binary, &p2)){
+        freePoly(p1);
+        return 1;
+    }
+
+    struct Node* result = addPolynomials(p1, p2);
+    printf("Sum: ");
+    display(result);
+
+    freePoly(p1);
+    freePoly(p2);
+    freePoly(result);
+    return 0;
+}
+
+/* Interactive runs add two polynomials; -a also adds the second into the first in place and
+   -e asks for points to evaluate the sum at */
+int main(int argc, char* argv[]){
     struct Node *p1 = NULL, *p2 = NULL, *result = NULL;
+    int inPlace = 0, evaluate = 0;
+
+    if (argc == 4 && (strcmp(argv[1], "-t") == 0 || strcmp(argv[1], "-b") == 0)){
+        return fileMode(argv[1][1] == 'b', argv[2], argv[3]);
+    }
+    for (int i = 1; i < argc; i++){
+        if (strcmp(argv[i], "-a") == 0) inPlace = 1;
+        else if (strcmp(argv[i], "-e") == 0) evaluate = 1;
+        else if (argc == 2 && atoi(argv[1]) > 0) return sumMode(atoi(argv[1]));
+        else {
+            printf("Usage: %s [-a] [-e] | [number of polynomials to sum] | [-t|-b file1 file2]\n", argv[0]);
+            return 1;
+        }
+    }
     
     printf("\nFirst Polynomial:\n");
     p1 = readPolynomial();
@@ -156,6 +726,15 @@ int main(){
     printf("\nSum: ");
     display(result);
     
+    if (inPlace){
+        p1 = accumulatePolynomial(p1, p2);
+        p2 = NULL;
+        printf("Polynomial 1 += Polynomial 2: ");
+        display(p1);
+    }
+    
+    if (evaluate) evaluateMenu(result);
+    
     freePoly(p1);
     freePoly(p2);
     freePoly(result);
@@ -6,67 +6,100 @@ Show the number of comparison required for a given input.
 
 #include<stdio.h>
 
+/* Operation counters for teaching builds; compile with -DSORT_STATS=0 to remove them from the sorts */
+#ifndef SORT_STATS
+#define SORT_STATS 1
+#endif
+
+struct SortStats{
+    long long comparisons;
+    long long swaps;
+    long long shifts;
+    long long bytesMoved;
+    int depth;
+    int maxDepth;
+};
+
+#if SORT_STATS
+struct SortStats stats;
+#define STAT_COMPARE() (stats.comparisons++)
+#define STAT_SWAP() (stats.swaps++, stats.bytesMoved += 2 * sizeof(int))
+#define STAT_SHIFT() (stats.shifts++, stats.bytesMoved += sizeof(int))
+#define STAT_MOVE(count) (stats.bytesMoved += (long long)(count) * sizeof(int))
+#else
+#define STAT_COMPARE() ((void)0)
+#define STAT_SWAP() ((void)0)
+#define STAT_SHIFT() ((void)0)
+#define STAT_MOVE(count) ((void)0)
+#endif
+
+void resetStats(){
+#if SORT_STATS
+    stats = (struct SortStats){0};
+#endif
+}
+
+void printStats(){
+#if SORT_STATS
+    printf("Comparisons: %lld\n", stats.comparisons);
+    printf("Swaps: %lld, Shifts: %lld, Bytes moved: %lld, Max recursion depth: %d\n",
+           stats.swaps, stats.shifts, stats.bytesMoved, stats.maxDepth);
+#endif
+}
+
 void printArray(int arr[], int n){
     for (int i = 0; i < n; i++) printf("%d ", arr[i]);
     printf("\n");
 }
 
-int bubbleSort(int arr[], int n){
-    int comparisons = 0, swaps = 0;
+void bubbleSort(int arr[], int n){
     for (int i = 0; i < n - 1; i++){
         int swapped = 0;
         for (int j = 0; j < n - i - 1; j++){
-            comparisons++;
+            STAT_COMPARE();
             if (arr[j] > arr[j + 1]){
                 int temp = arr[j];
                 arr[j] = arr[j + 1];
                 arr[j + 1] = temp;
-                swaps++;
+                STAT_SWAP();
                 swapped = 1;
             }
         }
         if (!swapped) break;
     }
-    printf("Swaps: %d\n", swaps);
-    return comparisons;
 }
 
-int selectionSort(int arr[], int n){
-    int comparisons = 0, swaps = 0;
+void selectionSort(int arr[], int n){
     for (int i = 0; i < n - 1; i++){
         int minIdx = i;
         for (int j = i + 1; j < n; j++){
-            comparisons++;
+            STAT_COMPARE();
             if (arr[j] < arr[minIdx]) minIdx = j;
         }
         if (minIdx != i){
             int temp = arr[minIdx];
             arr[minIdx] = arr[i];
             arr[i] = temp;
-            swaps++;
+            STAT_SWAP();
         }
     }
-    printf("Swaps: %d\n", swaps);
-    return comparisons;
 }
 
-int insertionSort(int arr[], int n){
-    int comparisons = 0, shifts = 0;
+void insertionSort(int arr[], int n){
     for (int i = 1; i < n; i++){
         int key = arr[i];
         int j = i - 1;
         while (j >= 0){
-            comparisons++;
+            STAT_COMPARE();
             if (arr[j] > key){
                 arr[j + 1] = arr[j];
                 j--;
-                shifts++;
+                STAT_SHIFT();
             } else break;
         }
         arr[j + 1] = key;
+        STAT_MOVE(1);
     }
-    printf("Shifts: %d\n", shifts);
-    return comparisons;
 }
 
 void copyArray(int src[], int dest[], int n){
@@ -91,22 +124,25 @@ int main(){
     printArray(orig, n);
     
     printf("\nBubble Sort:\n");
-    int comp1 = bubbleSort(arr1, n);
+    resetStats();
+    bubbleSort(arr1, n);
     printf("Sorted: ");
     printArray(arr1, n);
-    printf("Comparisons: %d\n", comp1);
+    printStats();
     
     printf("\nSelection Sort:\n");
-    int comp2 = selectionSort(arr2, n);
+    resetStats();
+    selectionSort(arr2, n);
     printf("Sorted: ");
     printArray(arr2, n);
-    printf("Comparisons: %d\n", comp2);
+    printStats();
     
     printf("\nInsertion Sort:\n");
-    int comp3 = insertionSort(arr3, n);
+    resetStats();
+    insertionSort(arr3, n);
     printf("Sorted: ");
     printArray(arr3, n);
-    printf("Comparisons: %d\n", comp3);
+    printStats();
     
     return 0;
 }